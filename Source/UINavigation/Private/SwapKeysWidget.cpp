@@ -17,9 +17,29 @@ void USwapKeysWidget::OnReturn_Implementation()
 	NotifySwapResult(FirstComponentIsAccept);
 }
 
+void USwapKeysWidget::PrewarmPromptData()
+{
+	if (!IsValid(SwapKeysPromptData))
+	{
+		SwapKeysPromptData = NewObject<UPromptDataSwapKeys>(this);
+	}
+}
+
+void USwapKeysWidget::ResetPromptState()
+{
+	// Cleared before the base class prewarms the prompt data again
+	SwapKeysPromptData = nullptr;
+
+	Super::ResetPromptState();
+
+	InputCollisionData = FInputCollisionData();
+	CurrentInputBox = nullptr;
+	CollidingInputBox = nullptr;
+}
+
 void USwapKeysWidget::NotifySwapResult(const bool bSwap)
 {
-	UPromptDataSwapKeys* SwapKeysPromptData = NewObject<UPromptDataSwapKeys>();
+	PrewarmPromptData();
 	if (!IsValid(SwapKeysPromptData))
 	{
 		return;
@@ -0,0 +1,332 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "UINavBenchmark.h"
+#include "UINavigation.h"
+#include "UINavPCComponent.h"
+#include "UINavBlueprintFunctionLibrary.h"
+#include "UINavWidget.h"
+#include "UINavInputBox.h"
+#include "UINavInputContainer.h"
+#include "Blueprint/WidgetBlueprintLibrary.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace UINavBenchmark
+{
+	FObjectAllocationCounter::FObjectAllocationCounter()
+	{
+		GUObjectArray.AddUObjectCreateListener(this);
+		bRegistered = true;
+	}
+
+	FObjectAllocationCounter::~FObjectAllocationCounter()
+	{
+		if (bRegistered)
+		{
+			GUObjectArray.RemoveUObjectCreateListener(this);
+		}
+	}
+
+	void FObjectAllocationCounter::NotifyUObjectCreated(const UObjectBase* Object, int32 Index)
+	{
+		NumAllocations.Increment();
+	}
+
+	void FObjectAllocationCounter::OnUObjectArrayShutdown()
+	{
+		GUObjectArray.RemoveUObjectCreateListener(this);
+		bRegistered = false;
+	}
+
+	FOpenWidgetMeasurement::FOpenWidgetMeasurement(UUINavPCComponent* InUINavPC, TFunction<UUINavWidget*(UUINavPCComponent*)> InOpenWidget, const FString& Name, const int32 Iterations)
+		: UINavPC(InUINavPC)
+		, OpenWidget(MoveTemp(InOpenWidget))
+	{
+		Result.Name = Name;
+		Result.Iterations = Iterations;
+	}
+
+	bool FOpenWidgetMeasurement::Update()
+	{
+		if (bFinished)
+		{
+			return true;
+		}
+
+		UUINavPCComponent* const PC = UINavPC.Get();
+		if (!IsValid(PC))
+		{
+			UE_LOG(LogUINavigation, Warning, TEXT("UINav.Benchmark: The UINavPC was destroyed while measuring %s"), *Result.Name);
+			Result.Iterations = Iteration;
+			Finish();
+			return true;
+		}
+
+		if (OpenedWidget.IsValid())
+		{
+			UUINavWidget* const Widget = OpenedWidget.Get();
+			if (!Widget->bCompletedSetup)
+			{
+				if (GFrameCounter - OpenFrame > MaxSetupFrames)
+				{
+					UE_LOG(LogUINavigation, Warning, TEXT("UINav.Benchmark: %s didn't complete its setup within %llu frames"), *Widget->GetName(), MaxSetupFrames);
+					CloseOpenedWidget(Widget);
+					Result.Iterations = Iteration;
+					Finish();
+					return true;
+				}
+				return false;
+			}
+
+			Result.TotalSeconds += FPlatformTime::Seconds() - OpenTime;
+			Result.TotalFrames += GFrameCounter - OpenFrame;
+			CloseOpenedWidget(Widget);
+			++Iteration;
+
+			// Let the parent widget's return finish before opening the next widget
+			return false;
+		}
+
+		if (Iteration >= Result.Iterations)
+		{
+			Finish();
+			return true;
+		}
+
+		if (!AllocationCounter.IsValid())
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			AllocationCounter = MakeUnique<FObjectAllocationCounter>();
+		}
+
+		OpenTime = FPlatformTime::Seconds();
+		OpenFrame = GFrameCounter;
+		UUINavWidget* const NewWidget = OpenWidget(PC);
+		if (!IsValid(NewWidget))
+		{
+			UE_LOG(LogUINavigation, Warning, TEXT("UINav.Benchmark: Couldn't open a widget for %s"), *Result.Name);
+			Result.Iterations = Iteration;
+			Finish();
+			return true;
+		}
+
+		if (NewWidget->bCompletedSetup)
+		{
+			Result.TotalSeconds += FPlatformTime::Seconds() - OpenTime;
+			CloseOpenedWidget(NewWidget);
+			++Iteration;
+			return false;
+		}
+
+		OpenedWidget = NewWidget;
+		return false;
+	}
+
+	void FOpenWidgetMeasurement::CloseOpenedWidget(UUINavWidget* Widget)
+	{
+		OpenedWidget.Reset();
+
+		UUINavPCComponent* const PC = UINavPC.Get();
+		if (IsValid(PC) && PC->GetActiveWidget() == Widget)
+		{
+			Widget->ReturnToParent();
+		}
+		else
+		{
+			Widget->RemoveFromParent();
+		}
+	}
+
+	void FOpenWidgetMeasurement::Finish()
+	{
+		bFinished = true;
+		Result.NewObjects = AllocationCounter.IsValid() ? AllocationCounter->GetNumAllocations() : 0;
+		AllocationCounter.Reset();
+	}
+
+	void MeasureActiveWidget(UUINavPCComponent* UINavPC, const int32 Iterations, TArray<FResult>& Results)
+	{
+		if (IsValid(UINavPC->GetActiveWidget()))
+		{
+			Measure(Results, TEXT("NavigationStep"), Iterations, [UINavPC](const int32 Iteration)
+			{
+				UINavPC->NavigateInDirection(Iteration % 2 == 0 ? EUINavigation::Down : EUINavigation::Up);
+			});
+		}
+
+		TArray<UUserWidget*> InputContainers;
+		UWidgetBlueprintLibrary::GetAllWidgetsOfClass(UINavPC, InputContainers, UUINavInputContainer::StaticClass(), /*bTopLevel*/ false);
+		for (UUserWidget* const Widget : InputContainers)
+		{
+			UUINavInputContainer* const InputContainer = Cast<UUINavInputContainer>(Widget);
+			if (!IsValid(InputContainer) || InputContainer->InputBoxes.Num() == 0)
+			{
+				continue;
+			}
+
+			Measure(Results, FString::Printf(TEXT("RebindValidation_%d_Inputs"), InputContainer->InputBoxes.Num()), Iterations, [InputContainer](const int32 Iteration)
+			{
+				UUINavInputBox* const InputBox = InputContainer->InputBoxes[Iteration % InputContainer->InputBoxes.Num()];
+				for (int32 KeyIndex = 0; KeyIndex < InputContainer->KeysPerInput; ++KeyIndex)
+				{
+					int CollidingActionIndex = INDEX_NONE;
+					int CollidingKeyIndex = INDEX_NONE;
+					InputContainer->CanUseKey(InputBox, InputBox->GetKey(KeyIndex), InputBox->bIsHoldInput[KeyIndex], CollidingActionIndex, CollidingKeyIndex);
+				}
+			});
+		}
+
+		Measure(Results, TEXT("RefreshNavigationKeys"), Iterations, [UINavPC](const int32 Iteration)
+		{
+			UINavPC->RefreshNavigationKeys();
+		});
+
+		Measure(Results, TEXT("InputIconRefresh"), Iterations, [UINavPC](const int32 Iteration)
+		{
+			UINavPC->ForceUpdateAllInputDisplays();
+		});
+	}
+
+	FString ToJson(const TArray<FResult>& Results)
+	{
+		FString Json = TEXT("{\n\t\"results\": [\n");
+		for (int32 i = 0; i < Results.Num(); ++i)
+		{
+			const FResult& Result = Results[i];
+			Json += FString::Printf(TEXT("\t\t{ \"name\": \"%s\", \"iterations\": %d, \"total_ms\": %.4f, \"average_us\": %.4f, \"average_frames\": %.2f, \"new_uobjects\": %d }%s\n"),
+				*Result.Name,
+				Result.Iterations,
+				Result.TotalSeconds * 1000.0,
+				Result.Iterations > 0 ? Result.TotalSeconds * 1000000.0 / Result.Iterations : 0.0,
+				Result.Iterations > 0 ? static_cast<double>(Result.TotalFrames) / Result.Iterations : 0.0,
+				Result.NewObjects,
+				i < Results.Num() - 1 ? TEXT(",") : TEXT(""));
+		}
+		Json += TEXT("\t]\n}\n");
+		return Json;
+	}
+
+	FString WriteResults(const TArray<FResult>& Results, const FString& FileName)
+	{
+		const FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UINavigation"), FileName);
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputPath), /*Tree*/ true);
+		FFileHelper::SaveStringToFile(ToJson(Results), *OutputPath);
+		return OutputPath;
+	}
+
+	/**
+	*	Opens the measured widget class over several frames, then measures the operations on the current menu
+	*/
+	class FBenchmarkRun
+	{
+	public:
+
+		bool Start(UUINavPCComponent* InUINavPC, const int32 InIterations, UClass* WidgetClass)
+		{
+			if (TickerHandle.IsValid())
+			{
+				return false;
+			}
+
+			UINavPC = InUINavPC;
+			Iterations = InIterations;
+			Results.Reset();
+
+			if (WidgetClass == nullptr)
+			{
+				Finish();
+				return true;
+			}
+
+			WidgetClassPtr.Reset(WidgetClass);
+			OpenWidgetMeasurement = MakeUnique<FOpenWidgetMeasurement>(InUINavPC, [this](UUINavPCComponent* PC)
+			{
+				return PC->GoToWidget(WidgetClassPtr.Get(), false);
+			}, TEXT("GoToWidget"), Iterations);
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FBenchmarkRun::Tick));
+			return true;
+		}
+
+	private:
+
+		TWeakObjectPtr<UUINavPCComponent> UINavPC;
+		// Kept alive so the class isn't unloaded by the garbage collections between measurements
+		TStrongObjectPtr<UClass> WidgetClassPtr;
+		int32 Iterations = 0;
+		TArray<FResult> Results;
+		TUniquePtr<FOpenWidgetMeasurement> OpenWidgetMeasurement;
+		FTSTicker::FDelegateHandle TickerHandle;
+
+		bool Tick(float DeltaTime)
+		{
+			if (!OpenWidgetMeasurement->Update())
+			{
+				return true;
+			}
+
+			Results.Add(OpenWidgetMeasurement->GetResult());
+			OpenWidgetMeasurement.Reset();
+			WidgetClassPtr.Reset();
+			TickerHandle.Reset();
+			Finish();
+			return false;
+		}
+
+		void Finish()
+		{
+			UUINavPCComponent* const PC = UINavPC.Get();
+			if (IsValid(PC))
+			{
+				MeasureActiveWidget(PC, Iterations, Results);
+			}
+
+			const FString OutputPath = WriteResults(Results, TEXT("Benchmark.json"));
+			UE_LOG(LogUINavigation, Display, TEXT("UINav.Benchmark results (%s):\n%s"), *OutputPath, *ToJson(Results));
+		}
+	};
+
+	static FBenchmarkRun BenchmarkRun;
+
+	/**
+	*	Measures the cost of UINavigation's main operations on the current menu and writes the results to Saved/UINavigation/Benchmark.json.
+	*	Usage: UINav.Benchmark [Iterations] [WidgetClassPath]
+	*/
+	static void Run(const TArray<FString>& Args, UWorld* World)
+	{
+		UUINavPCComponent* const UINavPC = UUINavBlueprintFunctionLibrary::GetFirstUINavPC(World);
+		if (!IsValid(UINavPC))
+		{
+			UE_LOG(LogUINavigation, Warning, TEXT("UINav.Benchmark: No UINavPCComponent found"));
+			return;
+		}
+
+		const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+
+		UClass* WidgetClass = nullptr;
+		if (Args.Num() > 1)
+		{
+			WidgetClass = LoadClass<UUINavWidget>(nullptr, *Args[1]);
+			if (WidgetClass == nullptr)
+			{
+				UE_LOG(LogUINavigation, Warning, TEXT("UINav.Benchmark: Couldn't load widget class %s"), *Args[1]);
+			}
+		}
+
+		if (!BenchmarkRun.Start(UINavPC, Iterations, WidgetClass))
+		{
+			UE_LOG(LogUINavigation, Warning, TEXT("UINav.Benchmark: A benchmark is already running"));
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs BenchmarkCommand(
+		TEXT("UINav.Benchmark"),
+		TEXT("Measures the cost of opening widgets, navigating, validating rebinds and refreshing input icons on the current menu. Usage: UINav.Benchmark [Iterations] [WidgetClassPath]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Run));
+}
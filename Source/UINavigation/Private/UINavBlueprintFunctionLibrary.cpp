@@ -8,6 +8,7 @@
 #include "UINavSettings.h"
 #include "UINavDefaultInputSettings.h"
 #include "UINavSavedInputSettings.h"
+#include "UINavLocalPlayerSubsystem.h"
 #include "UINavComponent.h"
 #include "UINavMacros.h"
 #include "Data/PromptData.h"
@@ -29,6 +30,11 @@
 #include "Misc/ConfigCacheIni.h"
 #include "Blueprint/UserWidget.h"
 #include "Blueprint/WidgetTree.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "EnhancedActionKeyMapping.h"
+#include "InputModifiers.h"
+#include "InputTriggers.h"
 
 void UUINavBlueprintFunctionLibrary::SetSoundClassVolume(USoundClass * TargetClass, const float NewVolume)
 {
@@ -78,52 +84,11 @@ void UUINavBlueprintFunctionLibrary::ResetInputSettings(APlayerController* PC)
 		UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer());
 		if (PC->InputComponent->IsA<UEnhancedInputComponent>() && Subsystem != nullptr)
 		{
-			const UUINavDefaultInputSettings* DefaultUINavInputSettings = GetDefault<UUINavDefaultInputSettings>();
-			for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingArray>& Entry : DefaultUINavInputSettings->DefaultEnhancedInputMappings)
+			UUINavLocalPlayerSubsystem* UINavLocalPlayerSubsystem = ULocalPlayer::GetSubsystem<UUINavLocalPlayerSubsystem>(PC->GetLocalPlayer());
+			if (IsValid(UINavLocalPlayerSubsystem))
 			{
-				UInputMappingContext* InputContext = Entry.Key.LoadSynchronous();
-
-				if (InputContext == nullptr)
-				{
-					continue;
-				}
-				
-				const FInputMappingArray& DefaultMappings = Entry.Value;
-				if (DefaultMappings.InputMappings.Num() == 0) continue;
-
-				InputContext->UnmapAll();
-
-				for (const FUINavEnhancedActionKeyMapping& DefaultInputMapping : DefaultMappings.InputMappings)
-				{
-					FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(DefaultInputMapping.Action.LoadSynchronous(), DefaultInputMapping.Key);
-
-					TArray<UInputModifier*> InputModifiers;
-					for (const TSoftObjectPtr<UInputModifier>& Modifier : DefaultInputMapping.Modifiers)
-					{
-						InputModifiers.Add(Modifier.LoadSynchronous());
-					}
-					NewMapping.Modifiers = InputModifiers;
-
-					TArray<UInputTrigger*> InputTriggers;
-					for (const TSoftObjectPtr<UInputTrigger>& Trigger : DefaultInputMapping.Triggers)
-					{
-						InputTriggers.Add(Trigger.LoadSynchronous());
-					}
-					NewMapping.Triggers = InputTriggers;
-				}
+				UINavLocalPlayerSubsystem->ResetInputContexts();
 			}
-
-			UUINavSavedInputSettings* SavedInputSettings = GetMutableDefault<UUINavSavedInputSettings>();
-			SavedInputSettings->SavedEnhancedInputMappings = DefaultUINavInputSettings->DefaultEnhancedInputMappings;
-			SavedInputSettings->SaveConfig();
-
-			UUINavPCComponent* UINavPC = PC->FindComponentByClass<UUINavPCComponent>();
-			if (IsValid(UINavPC))
-			{
-				UINavPC->RefreshNavigationKeys();
-			}
-
-			Subsystem->RequestRebuildControlMappings();
 		}
 	}
 }
@@ -474,6 +439,45 @@ const UUINavSettings* UUINavBlueprintFunctionLibrary::GetUINavSettings()
 	return GetDefault<UUINavSettings>();
 }
 
+UUINavPCComponent* UUINavBlueprintFunctionLibrary::GetFirstUINavPC(const UWorld* World)
+{
+	if (!IsValid(World))
+	{
+		return nullptr;
+	}
+
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* const PC = Iterator->Get();
+		UUINavPCComponent* const UINavPC = IsValid(PC) ? PC->FindComponentByClass<UUINavPCComponent>() : nullptr;
+		if (IsValid(UINavPC))
+		{
+			return UINavPC;
+		}
+	}
+
+	return nullptr;
+}
+
+void UUINavBlueprintFunctionLibrary::DuplicateMappingInstances(FEnhancedActionKeyMapping& Mapping, UObject* Outer)
+{
+	for (TObjectPtr<UInputModifier>& Modifier : Mapping.Modifiers)
+	{
+		if (IsValid(Modifier))
+		{
+			Modifier = DuplicateObject<UInputModifier>(Modifier, Outer);
+		}
+	}
+
+	for (TObjectPtr<UInputTrigger>& Trigger : Mapping.Triggers)
+	{
+		if (IsValid(Trigger))
+		{
+			Trigger = DuplicateObject<UInputTrigger>(Trigger, Outer);
+		}
+	}
+}
+
 bool UUINavBlueprintFunctionLibrary::IsVRKey(const FKey Key)
 {
 	return IsKeyInCategory(Key, "Oculus") || IsKeyInCategory(Key, "Vive") ||
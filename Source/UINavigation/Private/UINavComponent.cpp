@@ -10,6 +10,8 @@
 #include "Components/TextBlock.h"
 #include "Components/RichTextBlock.h"
 #include "Components/ScrollBox.h"
+#include "Components/ListView.h"
+#include "Blueprint/IUserListEntry.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Internationalization/Internationalization.h"
 #include "Sound/SoundBase.h"
@@ -19,6 +21,7 @@
 #include "Slate/SObjectWidget.h"
 #include "Templates/SharedPointer.h"
 #include "UINavigationConfig.h"
+#include "UINavStats.h"
 
 UUINavComponent::UUINavComponent(const FObjectInitializer& ObjectInitializer)
 	:Super(ObjectInitializer)
@@ -28,6 +31,26 @@ UUINavComponent::UUINavComponent(const FObjectInitializer& ObjectInitializer)
 	ComponentText = FText::FromString(TEXT("Button Text"));
 }
 
+void UUINavComponent::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!IsTemplate())
+	{
+		INC_DWORD_STAT(STAT_UINavLiveComponents);
+	}
+}
+
+void UUINavComponent::BeginDestroy()
+{
+	if (!IsTemplate())
+	{
+		DEC_DWORD_STAT(STAT_UINavLiveComponents);
+	}
+
+	Super::BeginDestroy();
+}
+
 void UUINavComponent::NativeConstruct()
 {
 	if (!IsValid(NavButton))
@@ -46,6 +69,9 @@ void UUINavComponent::NativeConstruct()
 
 	Super::NativeConstruct();
 
+	// List entries get recycled for other items, so the ListView is registered instead of the entry itself
+	UListView* const OwningListView = GetOwningListView();
+
 	if (!IsValid(ParentWidget))
 	{
 		ParentWidget = UUINavWidget::GetOuterObject<UUINavWidget>(this);
@@ -61,7 +87,7 @@ void UUINavComponent::NativeConstruct()
 			}
 		}
 		
-		if (!IsValid(ParentWidget->GetFirstComponent()) && CanBeNavigated())
+		if (!IsValid(ParentWidget->GetFirstComponent()) && !IsValid(OwningListView) && CanBeNavigated())
 		{
 			ParentWidget->SetFirstComponent(this);
 			if (ParentWidget->bCompletedSetup)
@@ -74,7 +100,7 @@ void UUINavComponent::NativeConstruct()
 	}
 	else
 	{
-		if (!IsValid(ParentWidget->GetFirstComponent()) && CanBeNavigated())
+		if (!IsValid(ParentWidget->GetFirstComponent()) && !IsValid(OwningListView) && CanBeNavigated())
 		{
 			ParentWidget->SetFirstComponent(this);
 			if (ParentWidget->bCompletedSetup)
@@ -84,6 +110,19 @@ void UUINavComponent::NativeConstruct()
 		}
 	}
 
+	if (IsValid(ParentWidget) && IsValid(OwningListView))
+	{
+		ParentWidget->SetFirstListView(OwningListView);
+
+		// Entries are generated on the list's first tick, after the widget's setup already looked for something to focus.
+		// Only the active widget takes focus, so lists in inactive parent or background menus don't steal it.
+		if (ParentWidget->bCompletedSetup && !IsValid(ParentWidget->GetCurrentComponent()) && !IsValid(ParentWidget->GetFirstComponent()) &&
+			IsValid(ParentWidget->UINavPC) && ParentWidget->UINavPC->GetActiveWidget() == ParentWidget->GetMostOuterUINavWidget())
+		{
+			ParentWidget->NavigateToListItem(OwningListView, 0);
+		}
+	}
+
 	SetFocusable(IsFocusable() && GetIsEnabled());
 }
 
@@ -396,6 +435,26 @@ bool UUINavComponent::CanBeNavigated() const
 		(NavButton->GetIsEnabled() || !bIgnoreDisabled));
 }
 
+UListView* UUINavComponent::GetOwningListView() const
+{
+	if (Implements<UUserListEntry>())
+	{
+		UListView* const OwningListView = Cast<UListView>(UUserListEntryLibrary::GetOwningListView(const_cast<UUINavComponent*>(this)));
+		if (IsValid(OwningListView))
+		{
+			return OwningListView;
+		}
+	}
+
+	return UUINavWidget::GetOuterObject<UListView>(this);
+}
+
+UObject* UUINavComponent::GetListItem() const
+{
+	const UListView* const OwningListView = GetOwningListView();
+	return IsValid(OwningListView) ? OwningListView->ItemFromEntryWidget(*this) : nullptr;
+}
+
 bool UUINavComponent::IsBeingNavigated() const
 {
 	return IsValid(ParentWidget) && ParentWidget->GetCurrentComponent() == this;
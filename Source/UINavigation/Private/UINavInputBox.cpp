@@ -7,8 +7,8 @@
 #include "UINavSettings.h"
 #include "UINavPCComponent.h"
 #include "UINavWidget.h"
-#include "UINavLocalPlayerSubsystem.h"
 #include "UINavBlueprintFunctionLibrary.h"
+#include "UINavStats.h"
 #include "Components/TextBlock.h"
 #include "Components/RichTextBlock.h"
 #include "Components/Image.h"
@@ -26,6 +26,26 @@ UUINavInputBox::UUINavInputBox(const FObjectInitializer& ObjectInitializer)
 	SetIsFocusable(false);
 }
 
+void UUINavInputBox::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!IsTemplate())
+	{
+		INC_DWORD_STAT(STAT_UINavLiveInputBoxes);
+	}
+}
+
+void UUINavInputBox::BeginDestroy()
+{
+	if (!IsTemplate())
+	{
+		DEC_DWORD_STAT(STAT_UINavLiveInputBoxes);
+	}
+
+	Super::BeginDestroy();
+}
+
 void UUINavInputBox::NativeConstruct()
 {
 	Super::NativeConstruct();
@@ -66,7 +86,7 @@ void UUINavInputBox::CreateEnhancedInputKeyWidgets()
 
 				bool bPositive;
 				EInputAxis Axis = InputActionData.Axis;
-				Container->UINavPC->GetAxisPropertiesFromMapping(ActionMapping, bPositive, Axis);
+				Container->UINavPC->GetAxisPropertiesFromMapping(InputContext, i, bPositive, Axis);
 				TArray<int32> MappingsForAction;
 				GetEnhancedMappingsForAction(ActionMapping.Action, InputActionData.Axis, j, MappingsForAction);
 				UUINavInputBox* OppositeInputBox = Container->GetOppositeInputBox(InputActionData);
@@ -91,7 +111,7 @@ void UUINavInputBox::CreateEnhancedInputKeyWidgets()
 						continue;
 					}
 
-					if (TrySetupNewKey(NewKey, j, NewInputButton, HasHoldModifier(ActionMapping)))
+					if (TrySetupNewKey(NewKey, j, NewInputButton, Container->UINavPC->GetMappingDescriptor(InputContext, i).bIsHold))
 					{
 						break;
 					}
@@ -212,18 +232,28 @@ int32 UUINavInputBox::FinishUpdateNewKey(const bool bIsHold /*= false*/, const i
 {
 	const FKey OldKey = Keys[AwaitingIndex];
 
+	Container->BeginRebindTransaction();
+
 	int32 ModifiedActionMappingIndex = FinishUpdateNewEnhancedInputKey(AwaitingNewKey, AwaitingIndex, bIsHold, MappingIndexToIgnore, TriggerToUse);
 
-	Container->OnKeyRebinded(InputName, OldKey, Keys[AwaitingIndex]);
-	Container->UINavPC->RefreshNavigationKeys();
-	Container->UINavPC->UpdateInputIconsDelegate.Broadcast();
+	Container->AddRebindEvent(InputName, OldKey, Keys[AwaitingIndex]);
 	AwaitingIndex = -1;
 
+	Container->CommitRebindTransaction();
+
 	return ModifiedActionMappingIndex;
 }
 
 int32 UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey& PressedKey, const int Index, const bool bIsHold /*= false*/, const int32 MappingIndexToIgnore /*= -1*/, const TObjectPtr<UInputTrigger> TriggerToUse /*= nullptr*/)
 {
+	SCOPE_CYCLE_COUNTER(STAT_UINavRebindKey);
+	UINAV_TRACE_SCOPE(UUINavInputBox::FinishUpdateNewEnhancedInputKey);
+
+	UINavTrace::TraceRebind(this, PressedKey, Index);
+
+	Container->BeginRebindTransaction();
+	Container->RecordRebindEdit(InputContext);
+
 	const TArray<FEnhancedActionKeyMapping>& ActionMappings = InputContext->GetMappings();
 
 	int32 ModifiedActionMappingIndex = -1;
@@ -243,7 +273,7 @@ int32 UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey& PressedKey, co
 		if (ActionMapping.Action == InputActionData.Action && i != MappingIndexToIgnore)
 		{
 			EInputAxis Axis = InputActionData.Axis;
-			Container->UINavPC->GetAxisPropertiesFromMapping(ActionMapping, bPositive, Axis);
+			Container->UINavPC->GetAxisPropertiesFromMapping(InputContext, i, bPositive, Axis);
 			if (InputActionData.Axis == Axis)
 			{
 				const FKey& MappingKey = GetKeyFromAxis(ActionMapping.Key);
@@ -380,10 +410,6 @@ int32 UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey& PressedKey, co
 		TryMapEnhancedAxisKey(NewKey, Index);
 	}
 
-	Container->UINavPC->RequestRebuildMappings();
-
-	ULocalPlayer::GetSubsystem<UUINavLocalPlayerSubsystem>(GetOwningLocalPlayer())->SaveInputContextState(InputContext);
-
 	UpdateKeyDisplay(Index);
 
 	if (bRemoved2DAxis)
@@ -391,6 +417,8 @@ int32 UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey& PressedKey, co
 		Container->ResetInputBox(InputName, InputActionData.Axis, AxisType == EAxisType::Positive ? EAxisType::Negative : EAxisType::Positive);
 	}
 
+	Container->CommitRebindTransaction();
+
 	return ModifiedActionMappingIndex;
 }
 
@@ -678,7 +706,7 @@ void UUINavInputBox::GetEnhancedMappingsForAction(const UInputAction* Action, co
 		{
 			bool bPositive;
 			EInputAxis ActionAxis = InputActionData.Axis;
-			Container->UINavPC->GetAxisPropertiesFromMapping(ActionMapping, bPositive, ActionAxis);
+			Container->UINavPC->GetAxisPropertiesFromMapping(InputContext, i, bPositive, ActionAxis);
 			if (ActionAxis == Axis && Container->RespectsRestriction(ActionMapping.Key, Index))
 			{
 				OutMappingIndices.Add(i);
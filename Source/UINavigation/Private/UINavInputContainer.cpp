@@ -8,15 +8,21 @@
 #include "UINavComponent.h"
 #include "UINavInputComponent.h"
 #include "UINavBlueprintFunctionLibrary.h"
+#include "UINavLocalPlayerSubsystem.h"
+#include "UINavStats.h"
 #include "Blueprint/UserWidget.h"
 #include "Blueprint/WidgetTree.h"
 #include "Engine/DataTable.h"
 #include "GameFramework/PlayerController.h"
+#include "Engine/LocalPlayer.h"
 #include "Components/PanelWidget.h"
 #include "Components/TextBlock.h"
 #include "Components/RichTextBlock.h"
 #include "IImageWrapper.h"
 #include "EnhancedInputComponent.h"
+#include "InputMappingContext.h"
+#include "Async/Async.h"
+#include "Tasks/Task.h"
 #include "UINavMacros.h"
 #include "Internationalization/Internationalization.h"
 #include "HAL/Platform.h"
@@ -53,6 +59,12 @@ void UUINavInputContainer::NativeConstruct()
 		UINavPC->InputTypeChangedDelegate.AddUniqueDynamic(this, &UUINavInputContainer::OnInputTypeChanged);
 	}
 
+	UUINavLocalPlayerSubsystem* UINavLocalPlayerSubsystem = ULocalPlayer::GetSubsystem<UUINavLocalPlayerSubsystem>(GetOwningLocalPlayer());
+	if (IsValid(UINavLocalPlayerSubsystem))
+	{
+		UINavLocalPlayerSubsystem->InputContextsAppliedDelegate.AddUniqueDynamic(this, &UUINavInputContainer::ForceUpdateInputBoxes);
+	}
+
 	KeysPerInput = InputRestrictions.Num();
 
 	DecidedCallback.BindUFunction(this, FName("SwapKeysDecided"));
@@ -69,6 +81,14 @@ void UUINavInputContainer::NativeDestruct()
 		UINavPC->InputTypeChangedDelegate.RemoveAll(this);
 	}
 
+	// Write any pending rebinds when the menu closes, instead of waiting for the save delay
+	UUINavLocalPlayerSubsystem* UINavLocalPlayerSubsystem = ULocalPlayer::GetSubsystem<UUINavLocalPlayerSubsystem>(GetOwningLocalPlayer());
+	if (IsValid(UINavLocalPlayerSubsystem))
+	{
+		UINavLocalPlayerSubsystem->InputContextsAppliedDelegate.RemoveAll(this);
+		UINavLocalPlayerSubsystem->FlushInputContextStates();
+	}
+
 	Super::NativeDestruct();
 }
 
@@ -100,12 +120,192 @@ void UUINavInputContainer::OnRebindCancelled_Implementation(ERevertRebindReason
 {
 }
 
+void UUINavInputContainer::OnInputConflictsAnalyzed_Implementation()
+{
+}
+
+void UUINavInputContainer::AnalyzeInputConflicts()
+{
+	if (!IsValid(UINavPC))
+	{
+		return;
+	}
+
+	// Immutable copy of everything the analysis needs. The object pointers are only compared, never dereferenced, by the task.
+	struct FMappingSnapshot
+	{
+		FKey Key;
+		const UInputAction* Action = nullptr;
+		const UInputMappingContext* InputContext = nullptr;
+		TArray<int> InputGroups;
+		bool bIsHold = false;
+		bool bInContainer = false;
+	};
+
+	TMap<const UInputAction*, TArray<int>> ContainerInputGroups;
+	for (const TPair<UInputMappingContext*, FInputContainerEnhancedActionDataArray>& Context : EnhancedInputs)
+	{
+		for (const FInputContainerEnhancedActionData& ActionData : Context.Value.Actions)
+		{
+			TArray<int>& InputGroups = ContainerInputGroups.FindOrAdd(ActionData.Action);
+			for (const int InputGroup : ActionData.InputGroupsOverride.Num() > 0 ? ActionData.InputGroupsOverride : Context.Value.InputGroups)
+			{
+				InputGroups.AddUnique(InputGroup);
+			}
+		}
+	}
+
+	TArray<FMappingSnapshot> Mappings;
+	for (const UInputMappingContext* const CachedInputContext : UINavPC->GetCachedInputContexts())
+	{
+		const UInputMappingContext* const InputContext = UINavPC->GetPlayerInputContext(CachedInputContext);
+		if (!IsValid(InputContext))
+		{
+			continue;
+		}
+
+		for (const FEnhancedActionKeyMapping& Mapping : InputContext->GetMappings())
+		{
+			if (!IsValid(Mapping.Action) || !Mapping.Key.IsValid())
+			{
+				continue;
+			}
+
+			FMappingSnapshot& MappingSnapshot = Mappings.AddDefaulted_GetRef();
+			MappingSnapshot.Key = Mapping.Key;
+			MappingSnapshot.Action = Mapping.Action;
+			MappingSnapshot.InputContext = CachedInputContext;
+			MappingSnapshot.bIsHold = UUINavInputBox::HasHoldModifier(Mapping);
+			if (const TArray<int>* const InputGroups = ContainerInputGroups.Find(Mapping.Action))
+			{
+				MappingSnapshot.InputGroups = *InputGroups;
+				MappingSnapshot.bInContainer = true;
+			}
+		}
+	}
+
+	const uint32 AnalysisId = ++InputConflictsAnalysisId;
+	bAnalyzingInputConflicts = true;
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[WeakThis = TWeakObjectPtr<UUINavInputContainer>(this), AnalysisId, Mappings = MoveTemp(Mappings)]()
+		{
+			TMap<FKey, TArray<int32>> MappingsPerKey;
+			for (int32 i = 0; i < Mappings.Num(); ++i)
+			{
+				MappingsPerKey.FindOrAdd(Mappings[i].Key).Add(i);
+			}
+
+			auto ShareInputGroup = [](const TArray<int>& InputGroups, const TArray<int>& OtherInputGroups)
+			{
+				if (InputGroups.Contains(-1) || OtherInputGroups.Contains(-1))
+				{
+					return true;
+				}
+
+				for (const int InputGroup : InputGroups)
+				{
+					if (OtherInputGroups.Contains(InputGroup))
+					{
+						return true;
+					}
+				}
+
+				return false;
+			};
+
+			TArray<FInputConflict> NewInputConflicts;
+			for (const TPair<FKey, TArray<int32>>& KeyMappings : MappingsPerKey)
+			{
+				const TArray<int32>& Indices = KeyMappings.Value;
+				for (int32 i = 0; i < Indices.Num(); ++i)
+				{
+					const FMappingSnapshot& Mapping = Mappings[Indices[i]];
+					for (int32 j = i + 1; j < Indices.Num(); ++j)
+					{
+						const FMappingSnapshot& OtherMapping = Mappings[Indices[j]];
+						if (Mapping.Action == OtherMapping.Action || Mapping.bIsHold != OtherMapping.bIsHold)
+						{
+							continue;
+						}
+
+						const bool bIsConflict = Mapping.bInContainer && OtherMapping.bInContainer ?
+							ShareInputGroup(Mapping.InputGroups, OtherMapping.InputGroups) :
+							Mapping.InputContext == OtherMapping.InputContext;
+						if (!bIsConflict)
+						{
+							continue;
+						}
+
+						FInputConflict& InputConflict = NewInputConflicts.AddDefaulted_GetRef();
+						InputConflict.Key = KeyMappings.Key;
+						InputConflict.Action = Mapping.Action;
+						InputConflict.InputContext = Mapping.InputContext;
+						InputConflict.CollidingAction = OtherMapping.Action;
+						InputConflict.CollidingInputContext = OtherMapping.InputContext;
+					}
+				}
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, AnalysisId, NewInputConflicts = MoveTemp(NewInputConflicts)]() mutable
+			{
+				if (UUINavInputContainer* const Container = WeakThis.Get())
+				{
+					Container->PublishInputConflicts(AnalysisId, MoveTemp(NewInputConflicts));
+				}
+			});
+		});
+}
+
+void UUINavInputContainer::PublishInputConflicts(const uint32 AnalysisId, TArray<FInputConflict>&& NewInputConflicts)
+{
+	if (AnalysisId != InputConflictsAnalysisId)
+	{
+		return;
+	}
+
+	bAnalyzingInputConflicts = false;
+	InputConflicts = MoveTemp(NewInputConflicts);
+	OnInputConflictsAnalyzed();
+}
+
+bool UUINavInputContainer::HasInputConflict(const UUINavInputBox* InputBox, const int KeyIndex) const
+{
+	if (!IsValid(InputBox) || !InputBox->InputActionData.Action)
+	{
+		return false;
+	}
+
+	const FKey Key = InputBox->GetKey(KeyIndex);
+	if (!Key.IsValid())
+	{
+		return false;
+	}
+
+	const UInputAction* const Action = InputBox->InputActionData.Action;
+	const FKey AxisKey = UINavPC != nullptr ? UINavPC->GetAxisFromKey(Key) : FKey();
+	for (const FInputConflict& InputConflict : InputConflicts)
+	{
+		if ((InputConflict.Action == Action || InputConflict.CollidingAction == Action) &&
+			(InputConflict.Key == Key || (AxisKey.IsValid() && InputConflict.Key == AxisKey)))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool UUINavInputContainer::RequestKeySwap(const FInputCollisionData& InputCollisionData, const int CurrentInputIndex, const int CollidingInputIndex) const
 {
 	if (SwapKeysWidgetClass != nullptr)
 	{
-		APlayerController* PC = Cast<APlayerController>(UINavPC->GetOwner());
-		USwapKeysWidget* SwapKeysWidget = CreateWidget<USwapKeysWidget>(PC, SwapKeysWidgetClass);
+		USwapKeysWidget* SwapKeysWidget = Cast<USwapKeysWidget>(UINavPC->AcquirePromptWidget(SwapKeysWidgetClass));
+		if (SwapKeysWidget == nullptr)
+		{
+			return false;
+		}
+
 		SwapKeysWidget->Title = SwapKeysTitleText;
 		FFormatNamedArguments MessageArgs;
 		MessageArgs.Add(TEXT("CollidingKey"), UINavPC->GetKeyText(InputCollisionData.PressedKey));
@@ -124,8 +324,8 @@ bool UUINavInputContainer::RequestKeySwap(const FInputCollisionData& InputCollis
 
 void UUINavInputContainer::ResetKeyMappings()
 {
+	// The input boxes are updated once the default mappings are applied
 	UUINavBlueprintFunctionLibrary::ResetInputSettings(Cast<APlayerController>(UINavPC->GetOwner()));
-	ForceUpdateInputBoxes();
 }
 
 void UUINavInputContainer::ForceUpdateInputBoxes()
@@ -171,8 +371,13 @@ void UUINavInputContainer::SetupInputBoxes()
 
 void UUINavInputContainer::CreateInputBoxes()
 {
+	SCOPE_CYCLE_COUNTER(STAT_UINavCreateInputBoxes);
+	UINAV_TRACE_SCOPE(UUINavInputContainer::CreateInputBoxes);
+
 	if (InputBox_BP == nullptr || UINavPC == nullptr) return;
 
+	UUINavLocalPlayerSubsystem* UINavLocalPlayerSubsystem = ULocalPlayer::GetSubsystem<UUINavLocalPlayerSubsystem>(GetOwningLocalPlayer());
+
 	for (int i = 0; i < NumberOfInputs; ++i)
 	{
 		UUINavInputBox* NewInputBox = CreateWidget<UUINavInputBox>(this, InputBox_BP);
@@ -189,7 +394,7 @@ void UUINavInputContainer::CreateInputBoxes()
 			}
 			else
 			{
-				NewInputBox->InputContext = Context.Key;
+				NewInputBox->InputContext = IsValid(UINavLocalPlayerSubsystem) ? UINavLocalPlayerSubsystem->GetPlayerInputContext(Context.Key) : Context.Key;
 				NewInputBox->InputActionData = Context.Value.Actions[Index];
 				NewInputBox->EnhancedInputGroups = Context.Value.Actions[Index].InputGroupsOverride.Num() > 0 ? Context.Value.Actions[Index].InputGroupsOverride : Context.Value.InputGroups;
 				break;
@@ -283,12 +488,144 @@ void UUINavInputContainer::ResetInputBox(const FName InputName, const EInputAxis
 			InputBox->InputActionData.Axis == Axis &&
 			InputBox->AxisType == AxisType)
 		{
-			InputBox->ResetKeyWidgets();
+			if (IsInRebindTransaction())
+			{
+				PendingInputBoxResets.AddUnique(InputBox);
+			}
+			else
+			{
+				InputBox->ResetKeyWidgets();
+			}
 			break;
 		}
 	}
 }
 
+void UUINavInputContainer::BeginRebindTransaction()
+{
+	++RebindTransactionDepth;
+}
+
+void UUINavInputContainer::RecordRebindEdit(UInputMappingContext* InputContext)
+{
+	if (!IsInRebindTransaction() || !IsValid(InputContext) || RebindTransactionSnapshots.Contains(InputContext))
+	{
+		return;
+	}
+
+	// Modifiers and triggers are edited in place by rebinds (e.g. negate flags), so they're copied as well
+	TArray<FEnhancedActionKeyMapping>& Snapshot = RebindTransactionSnapshots.Add(InputContext, InputContext->GetMappings());
+	for (FEnhancedActionKeyMapping& Mapping : Snapshot)
+	{
+		UUINavBlueprintFunctionLibrary::DuplicateMappingInstances(Mapping, this);
+		RebindTransactionInstances.Append(Mapping.Modifiers);
+		RebindTransactionInstances.Append(Mapping.Triggers);
+	}
+}
+
+void UUINavInputContainer::AddRebindEvent(const FName InputName, const FKey& OldKey, const FKey& NewKey)
+{
+	PendingKeyRebinds.Add({ InputName, OldKey, NewKey });
+}
+
+void UUINavInputContainer::CommitRebindTransaction()
+{
+	if (!IsInRebindTransaction())
+	{
+		DISPLAYERROR(TEXT("Tried to commit a rebind transaction that wasn't started!"));
+		return;
+	}
+
+	if (--RebindTransactionDepth > 0)
+	{
+		return;
+	}
+
+	TArray<UInputMappingContext*> EditedInputContexts;
+	RebindTransactionSnapshots.GenerateKeyArray(EditedInputContexts);
+	RebindTransactionSnapshots.Reset();
+	RebindTransactionInstances.Reset();
+
+	const TArray<UUINavInputBox*> InputBoxesToReset = MoveTemp(PendingInputBoxResets);
+	PendingInputBoxResets.Reset();
+	for (UUINavInputBox* InputBox : InputBoxesToReset)
+	{
+		InputBox->ResetKeyWidgets();
+	}
+
+	const TArray<FPendingKeyRebind> KeyRebinds = MoveTemp(PendingKeyRebinds);
+	PendingKeyRebinds.Reset();
+	for (const FPendingKeyRebind& KeyRebind : KeyRebinds)
+	{
+		OnKeyRebinded(KeyRebind.InputName, KeyRebind.OldKey, KeyRebind.NewKey);
+	}
+
+	if (EditedInputContexts.Num() == 0)
+	{
+		return;
+	}
+
+	if (IsValid(UINavPC))
+	{
+		for (const UInputMappingContext* const InputContext : EditedInputContexts)
+		{
+			UINavPC->InvalidateMappingDescriptors(InputContext);
+		}
+		UINavPC->RefreshNavigationKeys();
+		UINavPC->UpdateInputIconsDelegate.Broadcast();
+		UINavPC->RequestRebuildMappings();
+	}
+
+	UUINavLocalPlayerSubsystem* UINavLocalPlayerSubsystem = ULocalPlayer::GetSubsystem<UUINavLocalPlayerSubsystem>(GetOwningLocalPlayer());
+	if (IsValid(UINavLocalPlayerSubsystem))
+	{
+		for (UInputMappingContext* InputContext : EditedInputContexts)
+		{
+			UINavLocalPlayerSubsystem->SaveInputContextState(InputContext);
+		}
+	}
+}
+
+void UUINavInputContainer::RollbackRebindTransaction()
+{
+	if (!IsInRebindTransaction())
+	{
+		DISPLAYERROR(TEXT("Tried to roll back a rebind transaction that wasn't started!"));
+		return;
+	}
+
+	RebindTransactionDepth = 0;
+
+	for (const TPair<UInputMappingContext*, TArray<FEnhancedActionKeyMapping>>& Entry : RebindTransactionSnapshots)
+	{
+		UInputMappingContext* InputContext = Entry.Key;
+		if (!IsValid(InputContext))
+		{
+			continue;
+		}
+
+		InputContext->UnmapAll();
+		for (const FEnhancedActionKeyMapping& OldMapping : Entry.Value)
+		{
+			FEnhancedActionKeyMapping& RestoredMapping = InputContext->MapKey(OldMapping.Action, OldMapping.Key);
+			RestoredMapping = OldMapping;
+			UUINavBlueprintFunctionLibrary::DuplicateMappingInstances(RestoredMapping, InputContext);
+		}
+	}
+
+	RebindTransactionSnapshots.Reset();
+	RebindTransactionInstances.Reset();
+	PendingInputBoxResets.Reset();
+	PendingKeyRebinds.Reset();
+
+	if (IsValid(UINavPC))
+	{
+		UINavPC->InvalidateMappingDescriptors();
+	}
+
+	ForceUpdateInputBoxes();
+}
+
 void UUINavInputContainer::OnInputTypeChanged(const EInputType InputType)
 {
 	ForceUpdateInputBoxes();
@@ -314,13 +651,32 @@ void UUINavInputContainer::SwapKeysDecided(const UPromptDataBase* const PromptDa
 			const TObjectPtr<UInputTrigger> CurrentInputBoxTrigger = CollidingActionMapping != nullptr && !CollidingActionMapping->Triggers.IsEmpty() && bWasCurrentInputBoxHold && !bWasCollidingInputBoxHold ? DuplicateObject<UInputTrigger>(CollidingActionMapping->Triggers[0], this) : nullptr;
 			const TObjectPtr<UInputTrigger> CollidingInputBoxTrigger = CurrentActionMapping != nullptr && !CurrentActionMapping->Triggers.IsEmpty() && !bWasCurrentInputBoxHold && bWasCollidingInputBoxHold ? DuplicateObject<UInputTrigger>(CurrentActionMapping->Triggers[0], this) : nullptr;
 
+			// Both rebinds are committed together, so that their side effects only run once
+			BeginRebindTransaction();
+
 			int32 ModifiedActionMappingIndex = SwapKeysPromptData->CurrentInputBox->FinishUpdateNewKey(bWasCollidingInputBoxHold, -1, CurrentInputBoxTrigger);
+
+			// Only finish the swap if the first rebind took effect and the colliding key still has a mapping to rebind
+			const TArray<FKey>& CurrentKeys = SwapKeysPromptData->CurrentInputBox->Keys;
+			const int32 CurrentKeyIndex = SwapKeysPromptData->InputCollisionData.CurrentKeyIndex;
+			const bool bFirstRebindApplied = CurrentKeys.IsValidIndex(CurrentKeyIndex) &&
+				CurrentKeys[CurrentKeyIndex] != SwapKeysPromptData->InputCollisionData.CurrentInputKey;
+			if (!bFirstRebindApplied ||
+				SwapKeysPromptData->CollidingInputBox->GetActionMapping(SwapKeysPromptData->InputCollisionData.CollidingKeyIndex) == nullptr)
+			{
+				RollbackRebindTransaction();
+				OnRebindCancelled(ERevertRebindReason::None, SwapKeysPromptData->InputCollisionData.CurrentInputKey);
+				return;
+			}
+
 			SwapKeysPromptData->CollidingInputBox->UpdateInputKey(SwapKeysPromptData->InputCollisionData.CurrentInputKey,
 				bWasCurrentInputBoxHold,
 				SwapKeysPromptData->InputCollisionData.CollidingKeyIndex,
 				true,
 				ModifiedActionMappingIndex,
 				CollidingInputBoxTrigger);
+
+			CommitRebindTransaction();
 		}
 		else
 		{
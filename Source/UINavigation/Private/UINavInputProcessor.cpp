@@ -2,6 +2,86 @@
 
 #include "UINavInputProcessor.h"
 #include "UINavPCComponent.h"
+#include "UINavInputRecorder.h"
+
+UUINavPCComponent* FUINavInputProcessor::GetUINavPC(const int32 UserIndex) const
+{
+	if (UINavPCs.IsValidIndex(UserIndex))
+	{
+		if (UUINavPCComponent* const UINavPC = UINavPCs[UserIndex].Get())
+		{
+			return UINavPC;
+		}
+	}
+
+	// With a single local player, input from any user is handled by its UINavPC
+	if (NumUINavPCs == 1)
+	{
+		for (const TWeakObjectPtr<UUINavPCComponent>& UINavPC : UINavPCs)
+		{
+			if (UINavPC.IsValid())
+			{
+				return UINavPC.Get();
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+UUINavPCComponent* FUINavInputProcessor::GetUINavPCWithActiveWidget(const int32 UserIndex) const
+{
+	UUINavPCComponent* const UINavPC = GetUINavPC(UserIndex);
+	return UINavPC != nullptr && UINavPC->GetActiveWidget() != nullptr ? UINavPC : nullptr;
+}
+
+void FUINavInputProcessor::RegisterUINavPC(UUINavPCComponent* NewUINavPC, const int32 UserIndex)
+{
+	if (NewUINavPC == nullptr || UserIndex < 0)
+	{
+		return;
+	}
+
+	UnregisterUINavPC(NewUINavPC);
+	PruneStaleUINavPCs();
+
+	if (UserIndex >= UINavPCs.Num())
+	{
+		UINavPCs.SetNum(UserIndex + 1);
+	}
+
+	if (UINavPCs[UserIndex].IsExplicitlyNull())
+	{
+		NumUINavPCs++;
+	}
+
+	UINavPCs[UserIndex] = NewUINavPC;
+}
+
+void FUINavInputProcessor::UnregisterUINavPC(UUINavPCComponent* OldUINavPC)
+{
+	const int32 UserIndex = UINavPCs.IndexOfByKey(TWeakObjectPtr<UUINavPCComponent>(OldUINavPC));
+	if (UserIndex != INDEX_NONE)
+	{
+		UINavPCs[UserIndex].Reset();
+		NumUINavPCs--;
+	}
+
+	// Lets the module release the processor once the last live UINavPC is gone
+	PruneStaleUINavPCs();
+}
+
+void FUINavInputProcessor::PruneStaleUINavPCs()
+{
+	for (TWeakObjectPtr<UUINavPCComponent>& UINavPC : UINavPCs)
+	{
+		if (!UINavPC.IsExplicitlyNull() && !UINavPC.IsValid())
+		{
+			UINavPC.Reset();
+			NumUINavPCs--;
+		}
+	}
+}
 
 void FUINavInputProcessor::Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor)
 {
@@ -9,8 +89,19 @@ void FUINavInputProcessor::Tick(const float DeltaTime, FSlateApplication& SlateA
 
 bool FUINavInputProcessor::HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
 {
-	if (UINavPC != nullptr)
+	FUINavInputRecorder& InputRecorder = FUINavInputRecorder::Get();
+	if (InputRecorder.IsRecording())
 	{
+		InputRecorder.RecordKeyEvent(EUINavRecordedEventType::KeyDown, InKeyEvent);
+	}
+
+	if (UUINavPCComponent* const UINavPC = GetUINavPC(InKeyEvent.GetUserIndex()))
+	{
+		// Key repeats are handled by the navigation chain, so only the initial press is timed
+		if (!InKeyEvent.IsRepeat())
+		{
+			UINavPC->StampNavigationInput(/*bOverwrite*/ true);
+		}
 		UINavPC->HandleKeyDownEvent(SlateApp, InKeyEvent);
 	}
 
@@ -19,8 +110,15 @@ bool FUINavInputProcessor::HandleKeyDownEvent(FSlateApplication& SlateApp, const
 
 bool FUINavInputProcessor::HandleKeyUpEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
 {
-	if (UINavPC != nullptr)
+	FUINavInputRecorder& InputRecorder = FUINavInputRecorder::Get();
+	if (InputRecorder.IsRecording())
 	{
+		InputRecorder.RecordKeyEvent(EUINavRecordedEventType::KeyUp, InKeyEvent);
+	}
+
+	if (UUINavPCComponent* const UINavPC = GetUINavPC(InKeyEvent.GetUserIndex()))
+	{
+		UINavPC->ClearNavigationInputStamp();
 		UINavPC->HandleKeyUpEvent(SlateApp, InKeyEvent);
 	}
 
@@ -29,7 +127,14 @@ bool FUINavInputProcessor::HandleKeyUpEvent(FSlateApplication& SlateApp, const F
 
 bool FUINavInputProcessor::HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent)
 {
-	if (UINavPC != nullptr)
+	FUINavInputRecorder& InputRecorder = FUINavInputRecorder::Get();
+	if (InputRecorder.IsRecording())
+	{
+		InputRecorder.RecordAnalogEvent(InAnalogInputEvent);
+	}
+
+	// Analog events arrive every frame while a stick is held, so drop them early for users without an active menu
+	if (UUINavPCComponent* const UINavPC = GetUINavPCWithActiveWidget(InAnalogInputEvent.GetUserIndex()))
 	{
 		UINavPC->HandleAnalogInputEvent(SlateApp, InAnalogInputEvent);
 	}
@@ -39,8 +144,16 @@ bool FUINavInputProcessor::HandleAnalogInputEvent(FSlateApplication& SlateApp, c
 
 bool FUINavInputProcessor::HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
 {
-	if (UINavPC != nullptr)
+	FUINavInputRecorder& InputRecorder = FUINavInputRecorder::Get();
+	if (InputRecorder.IsRecording())
 	{
+		InputRecorder.RecordPointerEvent(EUINavRecordedEventType::MouseMove, MouseEvent);
+	}
+
+	if (UUINavPCComponent* const UINavPC = GetUINavPC(MouseEvent.GetUserIndex()))
+	{
+		// Focus changes caused by the pointer aren't navigations, so they mustn't finish a pending one
+		UINavPC->AbandonNavigationLatency();
 		UINavPC->HandleMouseMoveEvent(SlateApp, MouseEvent);
 	}
 
@@ -49,8 +162,15 @@ bool FUINavInputProcessor::HandleMouseMoveEvent(FSlateApplication& SlateApp, con
 
 bool FUINavInputProcessor::HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
 {
-	if (UINavPC != nullptr)
+	FUINavInputRecorder& InputRecorder = FUINavInputRecorder::Get();
+	if (InputRecorder.IsRecording())
+	{
+		InputRecorder.RecordPointerEvent(EUINavRecordedEventType::MouseButtonDown, MouseEvent);
+	}
+
+	if (UUINavPCComponent* const UINavPC = GetUINavPC(MouseEvent.GetUserIndex()))
 	{
+		UINavPC->AbandonNavigationLatency();
 		UINavPC->HandleMouseButtonDownEvent(SlateApp, MouseEvent);
 	}
 
@@ -59,7 +179,13 @@ bool FUINavInputProcessor::HandleMouseButtonDownEvent(FSlateApplication& SlateAp
 
 bool FUINavInputProcessor::HandleMouseButtonUpEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
 {
-	if (UINavPC != nullptr)
+	FUINavInputRecorder& InputRecorder = FUINavInputRecorder::Get();
+	if (InputRecorder.IsRecording())
+	{
+		InputRecorder.RecordPointerEvent(EUINavRecordedEventType::MouseButtonUp, MouseEvent);
+	}
+
+	if (UUINavPCComponent* const UINavPC = GetUINavPC(MouseEvent.GetUserIndex()))
 	{
 		UINavPC->HandleMouseButtonUpEvent(SlateApp, MouseEvent);
 	}
@@ -69,7 +195,13 @@ bool FUINavInputProcessor::HandleMouseButtonUpEvent(FSlateApplication& SlateApp,
 
 bool FUINavInputProcessor::HandleMouseWheelOrGestureEvent(FSlateApplication& SlateApp, const FPointerEvent& InWheelEvent, const FPointerEvent* InGesture)
 {
-	if (UINavPC != nullptr)
+	FUINavInputRecorder& InputRecorder = FUINavInputRecorder::Get();
+	if (InputRecorder.IsRecording())
+	{
+		InputRecorder.RecordPointerEvent(EUINavRecordedEventType::MouseWheel, InWheelEvent);
+	}
+
+	if (UUINavPCComponent* const UINavPC = GetUINavPC(InWheelEvent.GetUserIndex()))
 	{
 		UINavPC->HandleMouseWheelOrGestureEvent(SlateApp, InWheelEvent, InGesture);
 	}
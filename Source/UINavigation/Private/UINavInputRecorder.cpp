@@ -0,0 +1,490 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "UINavInputRecorder.h"
+#include "UINavigation.h"
+#include "UINavPCComponent.h"
+#include "UINavBlueprintFunctionLibrary.h"
+#include "UINavWidget.h"
+#include "UINavComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+
+FUINavInputRecorder& FUINavInputRecorder::Get()
+{
+	static FUINavInputRecorder InputRecorder;
+	return InputRecorder;
+}
+
+FString FUINavInputRecorder::GetRecordingPath(const FString& Name)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UINavigation"), TEXT("Recordings"), Name + TEXT(".uinavrec"));
+}
+
+bool FUINavInputRecorder::StartRecording(UUINavPCComponent* UINavPC)
+{
+	if (bRecording || bReplaying)
+	{
+		return false;
+	}
+
+	Names.Reset();
+	NameIndices.Reset();
+	Events.Reset();
+	StartFrame = GFrameCounter;
+	bRecording = true;
+
+	// The first transition holds the widget the session started on, so the replay can open it
+	NotifyActiveWidgetChanged(IsValid(UINavPC) ? UINavPC->GetActiveWidget() : nullptr);
+	return true;
+}
+
+bool FUINavInputRecorder::StopRecording(const FString& FilePath)
+{
+	if (!bRecording)
+	{
+		return false;
+	}
+
+	bRecording = false;
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), /*Tree*/ true);
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Writer.IsValid() || !Serialize(*Writer))
+	{
+		UE_LOG(LogUINavigation, Error, TEXT("Couldn't write input recording to %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogUINavigation, Display, TEXT("Saved input recording with %d events to %s"), Events.Num(), *FilePath);
+	return true;
+}
+
+bool FUINavInputRecorder::StartReplay(const FString& FilePath, UUINavPCComponent* UINavPC)
+{
+	if (bRecording || bReplaying || !IsValid(UINavPC) || !FSlateApplication::IsInitialized())
+	{
+		return false;
+	}
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader.IsValid() || !Serialize(*Reader) || Events.Num() == 0 || Events[0].Type != EUINavRecordedEventType::ActiveWidget)
+	{
+		UE_LOG(LogUINavigation, Error, TEXT("Couldn't read input recording from %s"), *FilePath);
+		return false;
+	}
+
+	bReplaying = true;
+	ReplayedTransitions.Reset();
+	ReplayFrame = 0;
+	NextReplayEvent = 1;
+	ReplayEndFrame = 0;
+	ReplayEndTime = 0.0;
+	NumRecordedTransitions = 0;
+	for (const FUINavRecordedEvent& Event : Events)
+	{
+		if (Event.IsTransition())
+		{
+			++NumRecordedTransitions;
+		}
+	}
+
+	const FString& InitialWidgetClassPath = Names[Events[0].NameIndex];
+	const UUINavWidget* const ActiveWidget = UINavPC->GetActiveWidget();
+	if (IsValid(ActiveWidget) && ActiveWidget->GetClass()->GetPathName() == InitialWidgetClassPath)
+	{
+		ReplayedTransitions.Add(Events[0]);
+	}
+	else if (UClass* const InitialWidgetClass = LoadClass<UUINavWidget>(nullptr, *InitialWidgetClassPath))
+	{
+		UINavPC->GoToWidget(InitialWidgetClass, false);
+	}
+
+	ReplayStartTime = FPlatformTime::Seconds();
+	ReplayTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FUINavInputRecorder::TickReplay));
+	return true;
+}
+
+void FUINavInputRecorder::StopReplay()
+{
+	if (!bReplaying)
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(ReplayTickerHandle);
+	ReplayTickerHandle.Reset();
+	bReplaying = false;
+}
+
+void FUINavInputRecorder::RecordKeyEvent(const EUINavRecordedEventType Type, const FKeyEvent& KeyEvent)
+{
+	FUINavRecordedEvent& Event = AddEvent(Type, KeyEvent.GetUserIndex());
+	Event.NameIndex = GetNameIndex(KeyEvent.GetKey().ToString());
+	Event.bIsRepeat = KeyEvent.IsRepeat();
+	Event.ModifierKeys = PackModifierKeys(KeyEvent.GetModifierKeys());
+	Event.CharacterCode = KeyEvent.GetCharacter();
+	Event.KeyCode = KeyEvent.GetKeyCode();
+}
+
+void FUINavInputRecorder::RecordAnalogEvent(const FAnalogInputEvent& AnalogEvent)
+{
+	FUINavRecordedEvent& Event = AddEvent(EUINavRecordedEventType::Analog, AnalogEvent.GetUserIndex());
+	Event.NameIndex = GetNameIndex(AnalogEvent.GetKey().ToString());
+	Event.Value = AnalogEvent.GetAnalogValue();
+	Event.ModifierKeys = PackModifierKeys(AnalogEvent.GetModifierKeys());
+}
+
+void FUINavInputRecorder::RecordPointerEvent(const EUINavRecordedEventType Type, const FPointerEvent& PointerEvent)
+{
+	FUINavRecordedEvent& Event = AddEvent(Type, PointerEvent.GetUserIndex());
+	Event.NameIndex = GetNameIndex(PointerEvent.GetEffectingButton().ToString());
+	Event.Position = FVector2f(PointerEvent.GetScreenSpacePosition());
+	Event.Value = PointerEvent.GetWheelDelta();
+	Event.ModifierKeys = PackModifierKeys(PointerEvent.GetModifierKeys());
+}
+
+void FUINavInputRecorder::NotifyActiveWidgetChanged(const UUINavWidget* NewActiveWidget)
+{
+	if (bRecording || bReplaying)
+	{
+		AddTransition(EUINavRecordedEventType::ActiveWidget, IsValid(NewActiveWidget) ? NewActiveWidget->GetClass()->GetPathName() : FString(), FString());
+	}
+}
+
+void FUINavInputRecorder::NotifyNavigatedTo(const UUINavWidget* Widget, const UUINavComponent* Component)
+{
+	if (bRecording || bReplaying)
+	{
+		AddTransition(EUINavRecordedEventType::Navigation, IsValid(Widget) ? Widget->GetClass()->GetPathName() : FString(), IsValid(Component) ? Component->GetName() : FString());
+	}
+}
+
+uint16 FUINavInputRecorder::GetNameIndex(const FString& Name)
+{
+	if (const uint16* const NameIndex = NameIndices.Find(Name))
+	{
+		return *NameIndex;
+	}
+
+	const uint16 NameIndex = static_cast<uint16>(Names.Add(Name));
+	NameIndices.Add(Name, NameIndex);
+	return NameIndex;
+}
+
+FUINavRecordedEvent& FUINavInputRecorder::AddEvent(const EUINavRecordedEventType Type, const uint32 UserIndex)
+{
+	FUINavRecordedEvent& Event = Events.AddDefaulted_GetRef();
+	Event.Frame = static_cast<uint32>(GFrameCounter - StartFrame);
+	Event.Type = Type;
+	Event.UserIndex = static_cast<uint8>(UserIndex);
+	return Event;
+}
+
+void FUINavInputRecorder::AddTransition(const EUINavRecordedEventType Type, const FString& WidgetName, const FString& ComponentName)
+{
+	FUINavRecordedEvent Transition;
+	Transition.Type = Type;
+	Transition.NameIndex = GetNameIndex(WidgetName);
+	Transition.SecondNameIndex = GetNameIndex(ComponentName);
+
+	if (bRecording)
+	{
+		Transition.Frame = static_cast<uint32>(GFrameCounter - StartFrame);
+		Events.Add(Transition);
+	}
+	else
+	{
+		Transition.Frame = ReplayFrame;
+		ReplayedTransitions.Add(Transition);
+	}
+}
+
+uint16 FUINavInputRecorder::PackModifierKeys(const FModifierKeysState& ModifierKeys)
+{
+	const bool Flags[] =
+	{
+		ModifierKeys.IsLeftShiftDown(), ModifierKeys.IsRightShiftDown(),
+		ModifierKeys.IsLeftControlDown(), ModifierKeys.IsRightControlDown(),
+		ModifierKeys.IsLeftAltDown(), ModifierKeys.IsRightAltDown(),
+		ModifierKeys.IsLeftCommandDown(), ModifierKeys.IsRightCommandDown(),
+		ModifierKeys.AreCapsLocked(),
+	};
+
+	uint16 PackedModifierKeys = 0;
+	int32 Bit = 0;
+	for (const bool bFlag : Flags)
+	{
+		if (bFlag)
+		{
+			PackedModifierKeys |= 1 << Bit;
+		}
+		++Bit;
+	}
+	return PackedModifierKeys;
+}
+
+FModifierKeysState FUINavInputRecorder::UnpackModifierKeys(const uint16 ModifierKeys)
+{
+	const auto IsSet = [ModifierKeys](const int32 Bit) { return (ModifierKeys & (1 << Bit)) != 0; };
+	return FModifierKeysState(IsSet(0), IsSet(1), IsSet(2), IsSet(3), IsSet(4), IsSet(5), IsSet(6), IsSet(7), IsSet(8));
+}
+
+bool FUINavInputRecorder::Serialize(FArchive& Ar)
+{
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	Ar << Magic;
+	Ar << Version;
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		return false;
+	}
+
+	Ar << Names;
+
+	int32 NumEvents = Events.Num();
+	Ar << NumEvents;
+	if (Ar.IsLoading())
+	{
+		if (NumEvents < 0)
+		{
+			return false;
+		}
+
+		Events.SetNum(NumEvents);
+		NameIndices.Reset();
+		for (int32 i = 0; i < Names.Num(); ++i)
+		{
+			NameIndices.Add(Names[i], static_cast<uint16>(i));
+		}
+	}
+
+	for (FUINavRecordedEvent& Event : Events)
+	{
+		uint8 Type = static_cast<uint8>(Event.Type);
+		Ar << Event.Frame;
+		Ar << Type;
+		Ar << Event.NameIndex;
+		Event.Type = static_cast<EUINavRecordedEventType>(Type);
+
+		switch (Event.Type)
+		{
+			case EUINavRecordedEventType::KeyDown:
+			case EUINavRecordedEventType::KeyUp:
+				Ar << Event.UserIndex;
+				Ar << Event.bIsRepeat;
+				Ar << Event.ModifierKeys;
+				Ar << Event.CharacterCode;
+				Ar << Event.KeyCode;
+				break;
+			case EUINavRecordedEventType::Analog:
+				Ar << Event.UserIndex;
+				Ar << Event.Value;
+				Ar << Event.ModifierKeys;
+				break;
+			case EUINavRecordedEventType::MouseMove:
+			case EUINavRecordedEventType::MouseButtonDown:
+			case EUINavRecordedEventType::MouseButtonUp:
+			case EUINavRecordedEventType::MouseWheel:
+				Ar << Event.UserIndex;
+				Ar << Event.Position;
+				Ar << Event.Value;
+				Ar << Event.ModifierKeys;
+				break;
+			case EUINavRecordedEventType::Navigation:
+				Ar << Event.SecondNameIndex;
+				break;
+			default:
+				break;
+		}
+
+		if (Event.NameIndex >= Names.Num() || Event.SecondNameIndex >= Names.Num())
+		{
+			return false;
+		}
+	}
+
+	return !Ar.IsError();
+}
+
+bool FUINavInputRecorder::TickReplay(float DeltaTime)
+{
+	while (Events.IsValidIndex(NextReplayEvent) && Events[NextReplayEvent].Frame <= ReplayFrame)
+	{
+		const FUINavRecordedEvent& Event = Events[NextReplayEvent++];
+		if (!Event.IsTransition())
+		{
+			ReplayEvent(Event);
+		}
+	}
+
+	if (!Events.IsValidIndex(NextReplayEvent))
+	{
+		if (ReplayEndTime <= 0.0)
+		{
+			ReplayEndFrame = ReplayFrame;
+			ReplayEndTime = FPlatformTime::Seconds();
+		}
+
+		// Transitions can happen a frame or more after their input, for example analog navigation, which is processed on tick
+		if (ReplayedTransitions.Num() >= NumRecordedTransitions || ReplayFrame - ReplayEndFrame >= MaxReplayGraceFrames)
+		{
+			FinishReplay();
+			return false;
+		}
+	}
+
+	++ReplayFrame;
+	return true;
+}
+
+void FUINavInputRecorder::ReplayEvent(const FUINavRecordedEvent& Event) const
+{
+	FSlateApplication& SlateApplication = FSlateApplication::Get();
+	const FKey Key(*Names[Event.NameIndex]);
+	const FModifierKeysState ModifierKeys = UnpackModifierKeys(Event.ModifierKeys);
+
+	switch (Event.Type)
+	{
+		case EUINavRecordedEventType::KeyDown:
+			SlateApplication.ProcessKeyDownEvent(FKeyEvent(Key, ModifierKeys, Event.UserIndex, Event.bIsRepeat, Event.CharacterCode, Event.KeyCode));
+			break;
+		case EUINavRecordedEventType::KeyUp:
+			SlateApplication.ProcessKeyUpEvent(FKeyEvent(Key, ModifierKeys, Event.UserIndex, Event.bIsRepeat, Event.CharacterCode, Event.KeyCode));
+			break;
+		case EUINavRecordedEventType::Analog:
+			SlateApplication.ProcessAnalogInputEvent(FAnalogInputEvent(Key, ModifierKeys, Event.UserIndex, false, 0, 0, Event.Value));
+			break;
+		case EUINavRecordedEventType::MouseMove:
+		case EUINavRecordedEventType::MouseButtonDown:
+		case EUINavRecordedEventType::MouseButtonUp:
+		case EUINavRecordedEventType::MouseWheel:
+		{
+			const FVector2D Position(Event.Position);
+			TSet<FKey> PressedButtons;
+			if (Event.Type == EUINavRecordedEventType::MouseButtonDown)
+			{
+				PressedButtons.Add(Key);
+			}
+
+			const FPointerEvent PointerEvent(Event.UserIndex, 0, Position, Position, PressedButtons, Key, Event.Value, ModifierKeys);
+			if (Event.Type == EUINavRecordedEventType::MouseMove)
+			{
+				SlateApplication.ProcessMouseMoveEvent(PointerEvent);
+			}
+			else if (Event.Type == EUINavRecordedEventType::MouseButtonDown)
+			{
+				SlateApplication.ProcessMouseButtonDownEvent(nullptr, PointerEvent);
+			}
+			else if (Event.Type == EUINavRecordedEventType::MouseButtonUp)
+			{
+				SlateApplication.ProcessMouseButtonUpEvent(PointerEvent);
+			}
+			else
+			{
+				SlateApplication.ProcessMouseWheelOrGestureEvent(PointerEvent, nullptr);
+			}
+			break;
+		}
+		default:
+			break;
+	}
+}
+
+void FUINavInputRecorder::FinishReplay()
+{
+	// The grace frames only wait for late transitions, so they aren't part of the timing
+	const double ReplayTime = ReplayEndTime - ReplayStartTime;
+	bReplaying = false;
+	ReplayTickerHandle.Reset();
+
+	UE_LOG(LogUINavigation, Display, TEXT("Input replay finished: %u frames in %.2fs (%.3fms per frame)"),
+		ReplayEndFrame, ReplayTime, ReplayEndFrame > 0 ? ReplayTime * 1000.0 / ReplayEndFrame : 0.0);
+
+	int32 TransitionIndex = 0;
+	for (const FUINavRecordedEvent& Event : Events)
+	{
+		if (!Event.IsTransition())
+		{
+			continue;
+		}
+
+		if (!ReplayedTransitions.IsValidIndex(TransitionIndex))
+		{
+			UE_LOG(LogUINavigation, Error, TEXT("Input replay diverged: expected transition %d to %s %s, but the replay ended"),
+				TransitionIndex, *Names[Event.NameIndex], *Names[Event.SecondNameIndex]);
+			return;
+		}
+
+		const FUINavRecordedEvent& ReplayedTransition = ReplayedTransitions[TransitionIndex];
+		if (ReplayedTransition.Type != Event.Type ||
+			ReplayedTransition.NameIndex != Event.NameIndex ||
+			ReplayedTransition.SecondNameIndex != Event.SecondNameIndex)
+		{
+			UE_LOG(LogUINavigation, Error, TEXT("Input replay diverged at transition %d (frame %u): expected %s %s, got %s %s"),
+				TransitionIndex, ReplayedTransition.Frame,
+				*Names[Event.NameIndex], *Names[Event.SecondNameIndex],
+				*Names[ReplayedTransition.NameIndex], *Names[ReplayedTransition.SecondNameIndex]);
+			return;
+		}
+
+		++TransitionIndex;
+	}
+
+	if (TransitionIndex != ReplayedTransitions.Num())
+	{
+		UE_LOG(LogUINavigation, Error, TEXT("Input replay diverged: %d unexpected transitions after the recorded ones"), ReplayedTransitions.Num() - TransitionIndex);
+		return;
+	}
+
+	UE_LOG(LogUINavigation, Display, TEXT("Input replay matched all %d recorded transitions"), TransitionIndex);
+}
+
+namespace UINavInputRecorder
+{
+	/**
+	*	Usage: UINav.Record Start | Stop [Name]
+	*/
+	static void Record(const TArray<FString>& Args, UWorld* World)
+	{
+		FUINavInputRecorder& InputRecorder = FUINavInputRecorder::Get();
+		const FString Name = Args.Num() > 1 ? Args[1] : TEXT("Session");
+
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("Stop"), ESearchCase::IgnoreCase))
+		{
+			InputRecorder.StopRecording(FUINavInputRecorder::GetRecordingPath(Name));
+		}
+		else if (!InputRecorder.StartRecording(UUINavBlueprintFunctionLibrary::GetFirstUINavPC(World)))
+		{
+			UE_LOG(LogUINavigation, Warning, TEXT("UINav.Record: Already recording or replaying"));
+		}
+	}
+
+	/**
+	*	Usage: UINav.Replay [Name]
+	*/
+	static void Replay(const TArray<FString>& Args, UWorld* World)
+	{
+		const FString Name = Args.Num() > 0 ? Args[0] : TEXT("Session");
+		if (!FUINavInputRecorder::Get().StartReplay(FUINavInputRecorder::GetRecordingPath(Name), UUINavBlueprintFunctionLibrary::GetFirstUINavPC(World)))
+		{
+			UE_LOG(LogUINavigation, Warning, TEXT("UINav.Replay: Couldn't start replaying %s"), *Name);
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs RecordCommand(
+		TEXT("UINav.Record"),
+		TEXT("Records the UINav input events and focus transitions to Saved/UINavigation/Recordings. Usage: UINav.Record Start | Stop [Name]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Record));
+
+	static FAutoConsoleCommandWithWorldAndArgs ReplayCommand(
+		TEXT("UINav.Replay"),
+		TEXT("Replays a UINav input recording and checks that the same focus transitions occur. Usage: UINav.Replay [Name]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Replay));
+}
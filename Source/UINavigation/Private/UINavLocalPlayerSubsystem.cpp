@@ -6,10 +6,20 @@
 #include "Engine/World.h"
 #include "EnhancedInputSubsystems.h"
 #include "UINavSavedInputSettings.h"
+#include "UINavDefaultInputSettings.h"
 #include "UINavSettings.h"
+#include "UINavInputProfilesSaveGame.h"
+#include "UINavMacros.h"
+#include "Kismet/GameplayStatics.h"
+#include "UObject/Package.h"
+#include "UINavPCComponent.h"
+#include "UINavBlueprintFunctionLibrary.h"
+#include "GameFramework/PlayerController.h"
 #include "InputMappingContext.h"
 #include "Subsystems/SubsystemCollection.h"
 #include "AssetRegistry/AssetData.h"
+#include "Misc/ConfigCacheIni.h"
+#include "TimerManager.h"
 
 void UUINavLocalPlayerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -18,11 +28,169 @@ void UUINavLocalPlayerSubsystem::Initialize(FSubsystemCollectionBase& Collection
 	Collection.InitializeDependency<UEnhancedInputLocalPlayerSubsystem>();
 }
 
+void UUINavLocalPlayerSubsystem::Deinitialize()
+{
+	FlushInputContextStates();
+
+	Super::Deinitialize();
+}
+
+UInputMappingContext* UUINavLocalPlayerSubsystem::GetPlayerInputContext(const UInputMappingContext* InputContext)
+{
+	if (!IsValid(InputContext) || !GetDefault<UUINavSettings>()->bUsePerPlayerInputContexts || InputContext->GetOuter() == this)
+	{
+		return const_cast<UInputMappingContext*>(InputContext);
+	}
+
+	TObjectPtr<UInputMappingContext>& PlayerInputContext = PlayerInputContexts.FindOrAdd(InputContext);
+	if (!IsValid(PlayerInputContext))
+	{
+		PlayerInputContext = DuplicateObject<UInputMappingContext>(InputContext, this, InputContext->GetFName());
+	}
+
+	return PlayerInputContext;
+}
+
+const UInputMappingContext* UUINavLocalPlayerSubsystem::GetSourceInputContext(const UInputMappingContext* InputContext) const
+{
+	if (!IsValid(InputContext) || InputContext->GetOuter() != this)
+	{
+		return InputContext;
+	}
+
+	const TObjectPtr<const UInputMappingContext>* const SourceInputContext = PlayerInputContexts.FindKey(const_cast<UInputMappingContext*>(InputContext));
+	return SourceInputContext != nullptr ? SourceInputContext->Get() : InputContext;
+}
+
+UInputMappingContext* UUINavLocalPlayerSubsystem::LoadPlayerInputContext(const TSoftObjectPtr<UInputMappingContext>& InputContextPtr)
+{
+	return GetPlayerInputContext(InputContextPtr.LoadSynchronous());
+}
+
+bool UUINavLocalPlayerSubsystem::UsesPlayerSaveData() const
+{
+	return GetDefault<UUINavSettings>()->bUsePerPlayerInputContexts && GetLocalPlayer()->GetLocalPlayerIndex() > 0;
+}
+
+int32 UUINavLocalPlayerSubsystem::GetSaveUserIndex() const
+{
+	return UsesPlayerSaveData() ? GetLocalPlayer()->GetLocalPlayerIndex() : 0;
+}
+
+FString UUINavLocalPlayerSubsystem::GetSavedInputMappingOverridesKey() const
+{
+	const FString Key = GET_MEMBER_NAME_CHECKED(UUINavSavedInputSettings, SavedInputMappingOverrides).ToString();
+	return UsesPlayerSaveData() ? FString::Printf(TEXT("%s_Player%d"), *Key, GetLocalPlayer()->GetLocalPlayerIndex()) : Key;
+}
+
+TMap<TSoftObjectPtr<UInputMappingContext>, FInputMappingOverrideArray>& UUINavLocalPlayerSubsystem::GetSavedInputMappingOverrides()
+{
+	if (!UsesPlayerSaveData())
+	{
+		return GetMutableDefault<UUINavSavedInputSettings>()->SavedInputMappingOverrides;
+	}
+
+	if (!bLoadedPlayerInputMappingOverrides)
+	{
+		bLoadedPlayerInputMappingOverrides = true;
+
+		const UClass* const SettingsClass = UUINavSavedInputSettings::StaticClass();
+		const FProperty* const OverridesProperty = FindFProperty<FProperty>(SettingsClass, GET_MEMBER_NAME_CHECKED(UUINavSavedInputSettings, SavedInputMappingOverrides));
+		FString OverridesText;
+		if (GConfig->GetString(*SettingsClass->GetPathName(), *GetSavedInputMappingOverridesKey(), OverridesText, SettingsClass->GetConfigName()))
+		{
+			OverridesProperty->ImportText_Direct(*OverridesText, &PlayerInputMappingOverrides, nullptr, PPF_None);
+		}
+	}
+
+	return PlayerInputMappingOverrides;
+}
+
 void UUINavLocalPlayerSubsystem::SaveInputContextState(UInputMappingContext* InputContext)
 {
-	UUINavSavedInputSettings* SavedUINavInputSettings = GetMutableDefault<UUINavSavedInputSettings>();
-	SavedUINavInputSettings->SavedEnhancedInputMappings.FindOrAdd(TSoftObjectPtr<UInputMappingContext>(FAssetData(InputContext).ToSoftObjectPath())) = InputContext->GetMappings();
-	SavedUINavInputSettings->SaveConfig();
+	const TSoftObjectPtr<UInputMappingContext> InputContextPtr(FAssetData(GetSourceInputContext(InputContext)).ToSoftObjectPath());
+	const FInputMappingArray* const DefaultMappings = GetDefault<UUINavDefaultInputSettings>()->DefaultEnhancedInputMappings.Find(InputContextPtr);
+
+	TMap<TSoftObjectPtr<UInputMappingContext>, FInputMappingOverrideArray>& SavedInputMappingOverrides = GetSavedInputMappingOverrides();
+	TArray<FInputMappingOverride> Overrides;
+	GetInputMappingOverrides(DefaultMappings, InputContext->GetMappings(), Overrides);
+	if (Overrides.Num() > 0)
+	{
+		SavedInputMappingOverrides.FindOrAdd(InputContextPtr).Overrides = MoveTemp(Overrides);
+	}
+	else
+	{
+		SavedInputMappingOverrides.Remove(InputContextPtr);
+	}
+	if (!UsesPlayerSaveData())
+	{
+		GetMutableDefault<UUINavSavedInputSettings>()->SavedEnhancedInputMappings.Remove(InputContextPtr);
+	}
+	bInputContextsDirty = true;
+
+	const float InputSaveDelay = GetDefault<UUINavSettings>()->InputSaveDelay;
+	UWorld* const World = GetWorld();
+	if (InputSaveDelay <= 0.0f || !IsValid(World))
+	{
+		FlushInputContextStates();
+		return;
+	}
+
+	// Restart the quiet period, so that consecutive rebinds result in a single write
+	World->GetTimerManager().SetTimer(SaveInputContextsTimerHandle, this, &UUINavLocalPlayerSubsystem::OnSaveInputContextsTimerFinished, InputSaveDelay, false);
+}
+
+void UUINavLocalPlayerSubsystem::OnSaveInputContextsTimerFinished()
+{
+	FlushInputContextStates();
+}
+
+void UUINavLocalPlayerSubsystem::FlushInputContextStates()
+{
+	UWorld* const World = GetWorld();
+	if (IsValid(World))
+	{
+		World->GetTimerManager().ClearTimer(SaveInputContextsTimerHandle);
+	}
+
+	if (!bInputContextsDirty)
+	{
+		return;
+	}
+
+	bInputContextsDirty = false;
+
+	const UClass* const SettingsClass = UUINavSavedInputSettings::StaticClass();
+	const FProperty* const MappingsProperty = FindFProperty<FProperty>(SettingsClass, GET_MEMBER_NAME_CHECKED(UUINavSavedInputSettings, SavedEnhancedInputMappings));
+	const FProperty* const OverridesProperty = FindFProperty<FProperty>(SettingsClass, GET_MEMBER_NAME_CHECKED(UUINavSavedInputSettings, SavedInputMappingOverrides));
+	const FString Filename = SettingsClass->GetConfigName();
+	const FString Section = SettingsClass->GetPathName();
+
+	// Secondary players with their own bindings don't touch the shared legacy mappings
+	if (!UsesPlayerSaveData())
+	{
+		FString MappingsText;
+		MappingsProperty->ExportTextItem_Direct(MappingsText, &GetDefault<UUINavSavedInputSettings>()->SavedEnhancedInputMappings, nullptr, nullptr, PPF_None);
+		GConfig->SetString(*Section, *MappingsProperty->GetName(), *MappingsText, Filename);
+	}
+
+	FString OverridesText;
+	OverridesProperty->ExportTextItem_Direct(OverridesText, &GetSavedInputMappingOverrides(), nullptr, nullptr, PPF_None);
+	GConfig->SetString(*Section, *GetSavedInputMappingOverridesKey(), *OverridesText, Filename);
+
+	// Only this ini file is written, and only once per quiet period
+	GConfig->Flush(false, Filename);
+}
+
+void UUINavLocalPlayerSubsystem::CancelPendingInputContextsWrite()
+{
+	UWorld* const World = GetWorld();
+	if (IsValid(World))
+	{
+		World->GetTimerManager().ClearTimer(SaveInputContextsTimerHandle);
+	}
+
+	bInputContextsDirty = false;
 }
 
 void UUINavLocalPlayerSubsystem::ApplySavedInputContexts()
@@ -44,14 +212,137 @@ void UUINavLocalPlayerSubsystem::ApplySavedInputContexts()
 	if (SavedUINavInputSettings->SavedInputVersion < CurrentInputVersion)
 	{
 		SavedUINavInputSettings->SavedEnhancedInputMappings.Reset();
+		SavedUINavInputSettings->SavedInputMappingOverrides.Reset();
 		SavedUINavInputSettings->SavedInputVersion = CurrentInputVersion;
+		CancelPendingInputContextsWrite();
 		SavedUINavInputSettings->SaveConfig();
+		if (UsesPlayerSaveData())
+		{
+			GetSavedInputMappingOverrides().Reset();
+			bInputContextsDirty = true;
+			FlushInputContextStates();
+		}
 		return;
 	}
 
+	TSet<FSoftObjectPath> AssetPaths;
 	for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingArray>& Entry : SavedUINavInputSettings->SavedEnhancedInputMappings)
 	{
-		UInputMappingContext* InputContext = Entry.Key.LoadSynchronous();
+		AssetPaths.Add(Entry.Key.ToSoftObjectPath());
+		for (const FUINavEnhancedActionKeyMapping& SavedInputMapping : Entry.Value.InputMappings)
+		{
+			GetInputMappingAssetPaths(SavedInputMapping, AssetPaths);
+		}
+	}
+	for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingOverrideArray>& Entry : GetSavedInputMappingOverrides())
+	{
+		AssetPaths.Add(Entry.Key.ToSoftObjectPath());
+		for (const FInputMappingOverride& Override : Entry.Value.Overrides)
+		{
+			GetInputMappingAssetPaths(Override.Mapping, AssetPaths);
+		}
+	}
+
+	LoadInputContextsAssets(AssetPaths.Array(), FStreamableDelegate::CreateUObject(this, &UUINavLocalPlayerSubsystem::FinishApplySavedInputContexts));
+}
+
+void UUINavLocalPlayerSubsystem::ResetInputContexts()
+{
+	TSet<FSoftObjectPath> AssetPaths;
+	for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingArray>& Entry : GetDefault<UUINavDefaultInputSettings>()->DefaultEnhancedInputMappings)
+	{
+		AssetPaths.Add(Entry.Key.ToSoftObjectPath());
+		for (const FUINavEnhancedActionKeyMapping& DefaultInputMapping : Entry.Value.InputMappings)
+		{
+			GetInputMappingAssetPaths(DefaultInputMapping, AssetPaths);
+		}
+	}
+
+	LoadInputContextsAssets(AssetPaths.Array(), FStreamableDelegate::CreateUObject(this, &UUINavLocalPlayerSubsystem::FinishResetInputContexts));
+}
+
+void UUINavLocalPlayerSubsystem::WaitForInputContexts()
+{
+	if (InputContextsLoadHandle.IsValid())
+	{
+		InputContextsLoadHandle->WaitUntilComplete();
+	}
+
+	// The streamable delegate may be deferred to a later frame, so apply the loaded assets now
+	FinishInputContextsLoad(InputContextsLoadSerial);
+}
+
+void UUINavLocalPlayerSubsystem::FinishInputContextsLoad(const uint32 LoadSerial)
+{
+	if (LoadSerial != InputContextsLoadSerial || !PendingInputContextsLoadedDelegate.IsBound())
+	{
+		return;
+	}
+
+	InputContextsLoadHandle.Reset();
+
+	const FStreamableDelegate LoadedDelegate = MoveTemp(PendingInputContextsLoadedDelegate);
+	PendingInputContextsLoadedDelegate.Unbind();
+	LoadedDelegate.ExecuteIfBound();
+}
+
+bool UUINavLocalPlayerSubsystem::IsLoadingInputContexts() const
+{
+	// Loaded assets whose mappings weren't applied yet still count as loading
+	return PendingInputContextsLoadedDelegate.IsBound();
+}
+
+void UUINavLocalPlayerSubsystem::LoadInputContextsAssets(TArray<FSoftObjectPath>&& AssetPaths, const FStreamableDelegate& LoadedDelegate)
+{
+	// Make sure previous requests are applied first, so that they don't override this one
+	WaitForInputContexts();
+
+	if (!GetDefault<UUINavSettings>()->bLoadInputContextsAsync || AssetPaths.Num() == 0)
+	{
+		LoadedDelegate.ExecuteIfBound();
+		return;
+	}
+
+	const uint32 LoadSerial = ++InputContextsLoadSerial;
+	PendingInputContextsLoadedDelegate = LoadedDelegate;
+	InputContextsLoadHandle = StreamableManager.RequestAsyncLoad(MoveTemp(AssetPaths),
+		FStreamableDelegate::CreateWeakLambda(this, [this, LoadSerial]()
+		{
+			FinishInputContextsLoad(LoadSerial);
+		}));
+	if (!InputContextsLoadHandle.IsValid())
+	{
+		FinishInputContextsLoad(LoadSerial);
+	}
+}
+
+void UUINavLocalPlayerSubsystem::GetInputMappingAssetPaths(const FUINavEnhancedActionKeyMapping& Mapping, TSet<FSoftObjectPath>& OutAssetPaths)
+{
+	if (!Mapping.Action.IsNull()) OutAssetPaths.Add(Mapping.Action.ToSoftObjectPath());
+
+	for (const TSoftObjectPtr<UInputModifier>& Modifier : Mapping.Modifiers)
+	{
+		if (!Modifier.IsNull()) OutAssetPaths.Add(Modifier.ToSoftObjectPath());
+	}
+
+	for (const TSoftObjectPtr<UInputTrigger>& Trigger : Mapping.Triggers)
+	{
+		if (!Trigger.IsNull()) OutAssetPaths.Add(Trigger.ToSoftObjectPath());
+	}
+}
+
+void UUINavLocalPlayerSubsystem::FinishApplySavedInputContexts()
+{
+	UEnhancedInputLocalPlayerSubsystem* EnhancedInputSubsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer());
+	if (!IsValid(EnhancedInputSubsystem))
+	{
+		return;
+	}
+
+	const UUINavSavedInputSettings* const SavedUINavInputSettings = GetDefault<UUINavSavedInputSettings>();
+	for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingArray>& Entry : SavedUINavInputSettings->SavedEnhancedInputMappings)
+	{
+		UInputMappingContext* InputContext = LoadPlayerInputContext(Entry.Key);
 
 		if (InputContext == nullptr)
 		{
@@ -66,22 +357,471 @@ void UUINavLocalPlayerSubsystem::ApplySavedInputContexts()
 		for (const FUINavEnhancedActionKeyMapping& SavedInputMapping : SavedMappings.InputMappings)
 		{
 			FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(SavedInputMapping.Action.LoadSynchronous(), SavedInputMapping.Key);
+			CopyInputMapping(SavedInputMapping, NewMapping);
+		}
+	}
+
+	const UUINavDefaultInputSettings* const DefaultUINavInputSettings = GetDefault<UUINavDefaultInputSettings>();
+	for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingOverrideArray>& Entry : GetSavedInputMappingOverrides())
+	{
+		if (Entry.Value.Overrides.Num() == 0) continue;
+
+		UInputMappingContext* InputContext = LoadPlayerInputContext(Entry.Key);
+		if (InputContext == nullptr)
+		{
+			continue;
+		}
+
+		ApplyInputMappingOverrides(InputContext, DefaultUINavInputSettings->DefaultEnhancedInputMappings.Find(Entry.Key), Entry.Value.Overrides);
+	}
+
+	EnhancedInputSubsystem->RequestRebuildControlMappings();
+
+	NotifyInputContextsApplied();
+}
+
+void UUINavLocalPlayerSubsystem::FinishResetInputContexts()
+{
+	UEnhancedInputLocalPlayerSubsystem* EnhancedInputSubsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer());
+	if (!IsValid(EnhancedInputSubsystem))
+	{
+		return;
+	}
+
+	const UUINavDefaultInputSettings* DefaultUINavInputSettings = GetDefault<UUINavDefaultInputSettings>();
+	for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingArray>& Entry : DefaultUINavInputSettings->DefaultEnhancedInputMappings)
+	{
+		UInputMappingContext* InputContext = LoadPlayerInputContext(Entry.Key);
+
+		if (InputContext == nullptr)
+		{
+			continue;
+		}
+		
+		const FInputMappingArray& DefaultMappings = Entry.Value;
+		if (DefaultMappings.InputMappings.Num() == 0) continue;
+
+		InputContext->UnmapAll();
+
+		for (const FUINavEnhancedActionKeyMapping& DefaultInputMapping : DefaultMappings.InputMappings)
+		{
+			FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(DefaultInputMapping.Action.LoadSynchronous(), DefaultInputMapping.Key);
+			CopyInputMapping(DefaultInputMapping, NewMapping);
+		}
+	}
+
+	if (UsesPlayerSaveData())
+	{
+		GetSavedInputMappingOverrides().Reset();
+		bInputContextsDirty = true;
+		FlushInputContextStates();
+	}
+	else
+	{
+		// The reset values supersede any pending write, and are flushed to disk by SaveConfig
+		CancelPendingInputContextsWrite();
+
+		UUINavSavedInputSettings* SavedInputSettings = GetMutableDefault<UUINavSavedInputSettings>();
+		SavedInputSettings->SavedEnhancedInputMappings.Reset();
+		SavedInputSettings->SavedInputMappingOverrides.Reset();
+		SavedInputSettings->SaveConfig();
+	}
+
+	EnhancedInputSubsystem->RequestRebuildControlMappings();
 
-			TArray<UInputModifier*> InputModifiers;
-			for (const TSoftObjectPtr<UInputModifier>& Modifier : SavedInputMapping.Modifiers)
+	NotifyInputContextsApplied();
+}
+
+void UUINavLocalPlayerSubsystem::NotifyInputContextsApplied()
+{
+	const APlayerController* const PC = GetLocalPlayer()->GetPlayerController(GetWorld());
+	UUINavPCComponent* const UINavPC = IsValid(PC) ? PC->FindComponentByClass<UUINavPCComponent>() : nullptr;
+	if (IsValid(UINavPC))
+	{
+		UINavPC->InvalidateMappingDescriptors();
+		UINavPC->RefreshNavigationKeys();
+	}
+
+	InputContextsAppliedDelegate.Broadcast();
+}
+
+void UUINavLocalPlayerSubsystem::GetInputMappingOverrides(const FInputMappingArray* DefaultMappings, const TArray<FEnhancedActionKeyMapping>& CurrentMappings, TArray<FInputMappingOverride>& OutOverrides)
+{
+	OutOverrides.Reset();
+
+	TMap<TSoftObjectPtr<const UInputAction>, TArray<FUINavEnhancedActionKeyMapping>> CurrentMappingsPerAction;
+	for (const FEnhancedActionKeyMapping& CurrentMapping : CurrentMappings)
+	{
+		CurrentMappingsPerAction.FindOrAdd(TSoftObjectPtr<const UInputAction>(CurrentMapping.Action)).Add(FUINavEnhancedActionKeyMapping(CurrentMapping));
+	}
+
+	TMap<TSoftObjectPtr<const UInputAction>, TArray<FUINavEnhancedActionKeyMapping>> DefaultMappingsPerAction;
+	if (DefaultMappings != nullptr)
+	{
+		for (const FUINavEnhancedActionKeyMapping& DefaultMapping : DefaultMappings->InputMappings)
+		{
+			DefaultMappingsPerAction.FindOrAdd(DefaultMapping.Action).Add(DefaultMapping);
+		}
+	}
+
+	static const TArray<FUINavEnhancedActionKeyMapping> EmptyMappings;
+	auto AddActionOverrides = [&OutOverrides](const TArray<FUINavEnhancedActionKeyMapping>& ActionDefaultMappings, const TArray<FUINavEnhancedActionKeyMapping>& ActionCurrentMappings)
+	{
+		const int32 NumSlots = FMath::Max(ActionDefaultMappings.Num(), ActionCurrentMappings.Num());
+		for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+		{
+			if (!ActionCurrentMappings.IsValidIndex(Slot))
+			{
+				OutOverrides.Add(FInputMappingOverride(Slot, ActionDefaultMappings[Slot], true));
+			}
+			else if (!ActionDefaultMappings.IsValidIndex(Slot) || !(ActionCurrentMappings[Slot] == ActionDefaultMappings[Slot]))
+			{
+				OutOverrides.Add(FInputMappingOverride(Slot, ActionCurrentMappings[Slot]));
+			}
+		}
+	};
+
+	for (const TPair<TSoftObjectPtr<const UInputAction>, TArray<FUINavEnhancedActionKeyMapping>>& ActionMappings : CurrentMappingsPerAction)
+	{
+		const TArray<FUINavEnhancedActionKeyMapping>* const ActionDefaultMappings = DefaultMappingsPerAction.Find(ActionMappings.Key);
+		AddActionOverrides(ActionDefaultMappings != nullptr ? *ActionDefaultMappings : EmptyMappings, ActionMappings.Value);
+	}
+
+	for (const TPair<TSoftObjectPtr<const UInputAction>, TArray<FUINavEnhancedActionKeyMapping>>& ActionMappings : DefaultMappingsPerAction)
+	{
+		if (!CurrentMappingsPerAction.Contains(ActionMappings.Key))
+		{
+			AddActionOverrides(ActionMappings.Value, EmptyMappings);
+		}
+	}
+}
+
+void UUINavLocalPlayerSubsystem::ApplyInputMappingOverrides(UInputMappingContext* InputContext, const FInputMappingArray* DefaultMappings, const TArray<FInputMappingOverride>& Overrides)
+{
+	TMap<TSoftObjectPtr<const UInputAction>, TArray<const FInputMappingOverride*>> OverridesPerAction;
+	for (const FInputMappingOverride& Override : Overrides)
+	{
+		OverridesPerAction.FindOrAdd(Override.Mapping.Action).Add(&Override);
+	}
+
+	for (const TPair<TSoftObjectPtr<const UInputAction>, TArray<const FInputMappingOverride*>>& ActionOverrides : OverridesPerAction)
+	{
+		const UInputAction* const Action = ActionOverrides.Key.LoadSynchronous();
+		if (Action == nullptr)
+		{
+			continue;
+		}
+
+		TArray<int32> MappingIndices;
+		const TArray<FEnhancedActionKeyMapping>& ContextMappings = InputContext->GetMappings();
+		for (int32 i = 0; i < ContextMappings.Num(); ++i)
+		{
+			if (ContextMappings[i].Action == Action)
 			{
-				InputModifiers.Add(Modifier.LoadSynchronous());
+				MappingIndices.Add(i);
 			}
-			NewMapping.Modifiers = InputModifiers;
+		}
 
-			TArray<UInputTrigger*> InputTriggers;
-			for (const TSoftObjectPtr<UInputTrigger>& Trigger : SavedInputMapping.Triggers)
+		// Start from the action's default mappings and patch each overriden slot
+		TArray<FUINavEnhancedActionKeyMapping> TargetMappings;
+		if (DefaultMappings != nullptr)
+		{
+			for (const FUINavEnhancedActionKeyMapping& DefaultMapping : DefaultMappings->InputMappings)
 			{
-				InputTriggers.Add(Trigger.LoadSynchronous());
+				if (DefaultMapping.Action == ActionOverrides.Key)
+				{
+					TargetMappings.Add(DefaultMapping);
+				}
+			}
+		}
+		else
+		{
+			for (const int32 MappingIndex : MappingIndices)
+			{
+				TargetMappings.Add(FUINavEnhancedActionKeyMapping(ContextMappings[MappingIndex]));
+			}
+		}
+
+		TArray<bool> RemovedSlots;
+		RemovedSlots.Init(false, TargetMappings.Num());
+		for (const FInputMappingOverride* const Override : ActionOverrides.Value)
+		{
+			if (Override->Slot < 0)
+			{
+				continue;
+			}
+
+			if (Override->Slot >= TargetMappings.Num())
+			{
+				TargetMappings.SetNum(Override->Slot + 1);
+				RemovedSlots.SetNum(Override->Slot + 1);
+				for (int32 i = RemovedSlots.Num() - 1; i >= 0 && TargetMappings[i].Action.IsNull(); --i)
+				{
+					RemovedSlots[i] = true;
+				}
+			}
+
+			TargetMappings[Override->Slot] = Override->Mapping;
+			RemovedSlots[Override->Slot] = Override->bRemoved;
+		}
+
+		for (int32 i = TargetMappings.Num() - 1; i >= 0; --i)
+		{
+			if (RemovedSlots[i])
+			{
+				TargetMappings.RemoveAt(i);
+			}
+		}
+
+		// Only touch the live mappings that differ from the target ones
+		for (int32 i = 0; i < TargetMappings.Num(); ++i)
+		{
+			if (MappingIndices.IsValidIndex(i))
+			{
+				FEnhancedActionKeyMapping& ContextMapping = InputContext->GetMapping(MappingIndices[i]);
+				if (!(FUINavEnhancedActionKeyMapping(ContextMapping) == TargetMappings[i]))
+				{
+					ContextMapping.Key = TargetMappings[i].Key;
+					CopyInputMapping(TargetMappings[i], ContextMapping);
+				}
+			}
+			else
+			{
+				FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(Action, TargetMappings[i].Key);
+				CopyInputMapping(TargetMappings[i], NewMapping);
+			}
+		}
+
+		if (MappingIndices.Num() > TargetMappings.Num())
+		{
+			// UnmapKey swaps the last mapping into the removed one's place, so remove by index while keeping the order of the others
+			TArray<FEnhancedActionKeyMapping> KeptMappings = InputContext->GetMappings();
+			for (int32 i = MappingIndices.Num() - 1; i >= TargetMappings.Num(); --i)
+			{
+				KeptMappings.RemoveAt(MappingIndices[i]);
+			}
+
+			InputContext->UnmapAll();
+			for (const FEnhancedActionKeyMapping& KeptMapping : KeptMappings)
+			{
+				InputContext->MapKey(KeptMapping.Action, KeptMapping.Key) = KeptMapping;
 			}
-			NewMapping.Triggers = InputTriggers;
 		}
 	}
+}
 
-	EnhancedInputSubsystem->RequestRebuildControlMappings();
+void UUINavLocalPlayerSubsystem::CopyInputMapping(const FUINavEnhancedActionKeyMapping& SourceMapping, FEnhancedActionKeyMapping& TargetMapping)
+{
+	TArray<UInputModifier*> InputModifiers;
+	for (const TSoftObjectPtr<UInputModifier>& Modifier : SourceMapping.Modifiers)
+	{
+		InputModifiers.Add(Modifier.LoadSynchronous());
+	}
+	TargetMapping.Modifiers = InputModifiers;
+
+	TArray<UInputTrigger*> InputTriggers;
+	for (const TSoftObjectPtr<UInputTrigger>& Trigger : SourceMapping.Triggers)
+	{
+		InputTriggers.Add(Trigger.LoadSynchronous());
+	}
+	TargetMapping.Triggers = InputTriggers;
+}
+
+void UUINavLocalPlayerSubsystem::SaveInputProfile(const FName ProfileName)
+{
+	if (ProfileName.IsNone())
+	{
+		DISPLAYERROR(TEXT("Input profiles need a name!"));
+		return;
+	}
+
+	UUINavInputProfilesSaveGame* const SaveGame = GetInputProfilesSaveGame();
+
+	TSet<TSoftObjectPtr<UInputMappingContext>> InputContexts;
+	const UUINavDefaultInputSettings* const DefaultUINavInputSettings = GetDefault<UUINavDefaultInputSettings>();
+	for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingArray>& Entry : DefaultUINavInputSettings->DefaultEnhancedInputMappings)
+	{
+		InputContexts.Add(Entry.Key);
+	}
+	for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingOverrideArray>& Entry : GetSavedInputMappingOverrides())
+	{
+		InputContexts.Add(Entry.Key);
+	}
+
+	FInputProfile& InputProfile = SaveGame->InputProfiles.FindOrAdd(ProfileName);
+	InputProfile.InputMappingOverrides.Reset();
+	FResolvedInputProfile& ResolvedInputProfile = ResolvedInputProfiles.FindOrAdd(ProfileName);
+	ResolvedInputProfile.InputContextMappings.Reset();
+	for (const TSoftObjectPtr<UInputMappingContext>& InputContextPtr : InputContexts)
+	{
+		UInputMappingContext* const InputContext = InputContextPtr.LoadSynchronous();
+		if (InputContext == nullptr)
+		{
+			continue;
+		}
+
+		const UInputMappingContext* const PlayerInputContext = GetPlayerInputContext(InputContext);
+		GetInputMappingOverrides(DefaultUINavInputSettings->DefaultEnhancedInputMappings.Find(InputContextPtr),
+			PlayerInputContext->GetMappings(),
+			InputProfile.InputMappingOverrides.Add(InputContextPtr).Overrides);
+
+		// Copy the modifiers and triggers too, so that later rebinds of the live mappings don't change the profile
+		TArray<FEnhancedActionKeyMapping>& ProfileMappings = ResolvedInputProfile.InputContextMappings.Add(InputContext).Mappings;
+		ProfileMappings = PlayerInputContext->GetMappings();
+		for (FEnhancedActionKeyMapping& ProfileMapping : ProfileMappings)
+		{
+			UUINavBlueprintFunctionLibrary::DuplicateMappingInstances(ProfileMapping, this);
+		}
+	}
+
+	SaveGame->ActiveInputProfile = ProfileName;
+	WriteInputProfiles();
+}
+
+bool UUINavLocalPlayerSubsystem::ApplyInputProfile(const FName ProfileName)
+{
+	UUINavInputProfilesSaveGame* const SaveGame = GetInputProfilesSaveGame();
+	const FResolvedInputProfile* const ResolvedInputProfile = ResolvedInputProfiles.Find(ProfileName);
+	if (ResolvedInputProfile == nullptr)
+	{
+		return false;
+	}
+
+	// Make sure pending loads don't override the profile's mappings once they finish
+	WaitForInputContexts();
+
+	for (const TPair<TObjectPtr<UInputMappingContext>, FResolvedInputMappings>& Entry : ResolvedInputProfile->InputContextMappings)
+	{
+		UInputMappingContext* const InputContext = GetPlayerInputContext(Entry.Key);
+		if (!IsValid(InputContext))
+		{
+			continue;
+		}
+
+		InputContext->UnmapAll();
+		for (const FEnhancedActionKeyMapping& ProfileMapping : Entry.Value.Mappings)
+		{
+			FEnhancedActionKeyMapping& NewMapping = InputContext->MapKey(ProfileMapping.Action, ProfileMapping.Key);
+			NewMapping = ProfileMapping;
+			UUINavBlueprintFunctionLibrary::DuplicateMappingInstances(NewMapping, InputContext);
+		}
+
+		SaveInputContextState(InputContext);
+	}
+
+	SaveGame->ActiveInputProfile = ProfileName;
+	WriteInputProfiles();
+
+	UEnhancedInputLocalPlayerSubsystem* EnhancedInputSubsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer());
+	if (IsValid(EnhancedInputSubsystem))
+	{
+		EnhancedInputSubsystem->RequestRebuildControlMappings();
+	}
+
+	NotifyInputContextsApplied();
+
+	return true;
+}
+
+bool UUINavLocalPlayerSubsystem::DeleteInputProfile(const FName ProfileName)
+{
+	UUINavInputProfilesSaveGame* const SaveGame = GetInputProfilesSaveGame();
+	ResolvedInputProfiles.Remove(ProfileName);
+	if (SaveGame->InputProfiles.Remove(ProfileName) == 0)
+	{
+		return false;
+	}
+
+	if (SaveGame->ActiveInputProfile == ProfileName)
+	{
+		SaveGame->ActiveInputProfile = NAME_None;
+	}
+
+	WriteInputProfiles();
+	return true;
+}
+
+TArray<FName> UUINavLocalPlayerSubsystem::GetInputProfileNames()
+{
+	TArray<FName> ProfileNames;
+	GetInputProfilesSaveGame()->InputProfiles.GenerateKeyArray(ProfileNames);
+	return ProfileNames;
+}
+
+FName UUINavLocalPlayerSubsystem::GetActiveInputProfile()
+{
+	return GetInputProfilesSaveGame()->ActiveInputProfile;
+}
+
+UUINavInputProfilesSaveGame* UUINavLocalPlayerSubsystem::GetInputProfilesSaveGame()
+{
+	if (IsValid(InputProfilesSaveGame))
+	{
+		return InputProfilesSaveGame;
+	}
+
+	const FString& SaveSlot = GetDefault<UUINavSettings>()->InputProfilesSaveSlot;
+	if (UGameplayStatics::DoesSaveGameExist(SaveSlot, GetSaveUserIndex()))
+	{
+		InputProfilesSaveGame = Cast<UUINavInputProfilesSaveGame>(UGameplayStatics::LoadGameFromSlot(SaveSlot, GetSaveUserIndex()));
+	}
+
+	if (!IsValid(InputProfilesSaveGame))
+	{
+		InputProfilesSaveGame = Cast<UUINavInputProfilesSaveGame>(UGameplayStatics::CreateSaveGameObject(UUINavInputProfilesSaveGame::StaticClass()));
+	}
+
+	// Resolve every profile up front, so that switching profiles doesn't need to load anything
+	ResolvedInputProfiles.Reset();
+	for (const TPair<FName, FInputProfile>& Entry : InputProfilesSaveGame->InputProfiles)
+	{
+		ResolveInputProfile(Entry.Value, ResolvedInputProfiles.Add(Entry.Key));
+	}
+
+	return InputProfilesSaveGame;
+}
+
+void UUINavLocalPlayerSubsystem::WriteInputProfiles()
+{
+	if (!IsValid(InputProfilesSaveGame))
+	{
+		return;
+	}
+
+	// The profiles are serialized right away and written to disk in the background
+	UGameplayStatics::AsyncSaveGameToSlot(InputProfilesSaveGame, GetDefault<UUINavSettings>()->InputProfilesSaveSlot, GetSaveUserIndex());
+}
+
+void UUINavLocalPlayerSubsystem::ResolveInputProfile(const FInputProfile& InputProfile, FResolvedInputProfile& OutResolvedInputProfile)
+{
+	OutResolvedInputProfile.InputContextMappings.Reset();
+
+	const UUINavDefaultInputSettings* const DefaultUINavInputSettings = GetDefault<UUINavDefaultInputSettings>();
+	UInputMappingContext* const ScratchInputContext = NewObject<UInputMappingContext>(GetTransientPackage());
+	for (const TPair<TSoftObjectPtr<UInputMappingContext>, FInputMappingOverrideArray>& Entry : InputProfile.InputMappingOverrides)
+	{
+		UInputMappingContext* const InputContext = Entry.Key.LoadSynchronous();
+		if (InputContext == nullptr)
+		{
+			continue;
+		}
+
+		// Build the profile's mappings in a scratch context, so that the actual input context isn't modified
+		ScratchInputContext->UnmapAll();
+		const FInputMappingArray* const DefaultMappings = DefaultUINavInputSettings->DefaultEnhancedInputMappings.Find(Entry.Key);
+		if (DefaultMappings != nullptr)
+		{
+			for (const FUINavEnhancedActionKeyMapping& DefaultInputMapping : DefaultMappings->InputMappings)
+			{
+				FEnhancedActionKeyMapping& NewMapping = ScratchInputContext->MapKey(DefaultInputMapping.Action.LoadSynchronous(), DefaultInputMapping.Key);
+				CopyInputMapping(DefaultInputMapping, NewMapping);
+			}
+		}
+
+		ApplyInputMappingOverrides(ScratchInputContext, DefaultMappings, Entry.Value.Overrides);
+
+		OutResolvedInputProfile.InputContextMappings.Add(InputContext).Mappings = ScratchInputContext->GetMappings();
+	}
+
+	ScratchInputContext->MarkAsGarbage();
 }
@@ -13,6 +13,11 @@
 #include "UINavigationConfig.h"
 #include "SwapKeysWidget.h"
 #include "Components/ScrollBox.h"
+#include "Components/PanelWidget.h"
+#include "Components/VerticalBox.h"
+#include "Components/HorizontalBox.h"
+#include "Components/UniformGridSlot.h"
+#include "Components/GridSlot.h"
 #include "GameFramework/InputSettings.h"
 #include "GameFramework/PlayerInput.h"
 #include "Data/AxisType.h"
@@ -21,14 +26,16 @@
 #include "Data/PlatformConfigData.h"
 #include "UINavBlueprintFunctionLibrary.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
-#include "UINavInputProcessor.h"
+#include "UINavigation.h"
+#include "UINavStats.h"
+#include "UINavInputRecorder.h"
 #include "GenericPlatform/GenericPlatformInputDeviceMapper.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Framework/Application/SlateUser.h"
 #include "TimerManager.h"
 #include "InputCoreTypes.h"
 #include "EnhancedInputSubsystems.h"
-#include "EnhancedInputLibrary.h"
+#include "Misc/CoreDelegates.h"
 #include "EnhancedPlayerInput.h"
 #include "EnhancedActionKeyMapping.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -36,6 +43,7 @@
 #include "Engine/GameViewportClient.h"
 #include "UnrealClient.h"
 #include "Engine/World.h"
+#include "Engine/LocalPlayer.h"
 #include "Engine/Texture2D.h"
 #include "UObject/SoftObjectPtr.h"
 #include "UObject/WeakObjectPtrTemplates.h"
@@ -48,6 +56,8 @@
 #include "InputKeyEventArgs.h"
 #include "Widgets/SWidget.h"
 #include "Widgets/SViewport.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectHash.h"
 
 const FKey UUINavPCComponent::MouseUp("MouseUp");
 const FKey UUINavPCComponent::MouseDown("MouseDown");
@@ -123,7 +133,7 @@ void UUINavPCComponent::BeginPlay()
 		return;
 	}
 
-	if (PC != nullptr && !SharedInputProcessor.IsValid())
+	if (PC != nullptr && !bRegisteredInputProcessor)
 	{
 		UUINavLocalPlayerSubsystem* UINavLocalPlayerSubsystem = ULocalPlayer::GetSubsystem<UUINavLocalPlayerSubsystem>(PC->GetLocalPlayer());
 		if (IsValid(UINavLocalPlayerSubsystem)) UINavLocalPlayerSubsystem->ApplySavedInputContexts();
@@ -133,7 +143,7 @@ void UUINavPCComponent::BeginPlay()
 		if (IsValid(GetEnhancedInputComponent()))
 		{
 			const UUINavSettings* const UINavSettings = GetDefault<UUINavSettings>();
-			const UInputMappingContext* InputContext = GetUINavInputContext(ActiveWidget);
+			const UInputMappingContext* InputContext = GetPlayerInputContext(GetUINavInputContext(ActiveWidget));
 			const UUINavEnhancedInputActions* const InputActions = UINavSettings->EnhancedInputActions.LoadSynchronous();
 		
 			if (!IsValid(InputContext) ||
@@ -160,9 +170,7 @@ void UUINavPCComponent::BeginPlay()
 			}
 		}
 		
-		SharedInputProcessor = MakeShareable(new FUINavInputProcessor());
-		SharedInputProcessor->SetUINavPC(this);
-		FSlateApplication::Get().RegisterInputPreProcessor(SharedInputProcessor);
+		bPendingInputProcessorRegistration = !TryRegisterInputProcessor();
 
 		CacheGameInputContexts();
 		TryResetDefaultInputs();
@@ -175,11 +183,29 @@ void UUINavPCComponent::BeginPlay()
 	}
 }
 
+bool UUINavPCComponent::TryRegisterInputProcessor()
+{
+	// Registering with another user's index would route that user's input to this player, so wait for our own
+	const ULocalPlayer* const LocalPlayer = PC->GetLocalPlayer();
+	const TSharedPtr<FSlateUser> SlateUser = LocalPlayer != nullptr ? LocalPlayer->GetSlateUser() : nullptr;
+	if (!SlateUser.IsValid())
+	{
+		return false;
+	}
+
+	FUINavigationModule::Get().RegisterUINavPC(this, SlateUser->GetUserIndex());
+	bRegisteredInputProcessor = true;
+	return true;
+}
+
 void UUINavPCComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (PC != nullptr && PC->IsLocalController())
+	bPendingInputProcessorRegistration = false;
+
+	if (bRegisteredInputProcessor)
 	{
-		FSlateApplication::Get().UnregisterInputPreProcessor(SharedInputProcessor);
+		FUINavigationModule::Get().UnregisterUINavPC(this);
+		bRegisteredInputProcessor = false;
 	}
 
 	if (GetDefault<UUINavSettings>()->bRemoveActiveWidgetsOnEndPlay && IsValid(ActiveWidget))
@@ -189,6 +215,8 @@ void UUINavPCComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	
 	IPlatformInputDeviceMapper::Get().GetOnInputDeviceConnectionChange().RemoveAll(this);
 
+	FlushRebuildMappings();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -196,30 +224,30 @@ void UUINavPCComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (bChainNavigation)
+	SCOPE_CYCLE_COUNTER(STAT_UINavPCTick);
+	UINAV_TRACE_SCOPE(UUINavPCComponent::TickComponent);
+
+	if (bPendingInputProcessorRegistration)
+	{
+		bPendingInputProcessorRegistration = !TryRegisterInputProcessor();
+	}
+
+	if (bChainNavigation && CountdownPhase != ECountdownPhase::None)
+	{
+		TickNavigationChain(DeltaTime);
+	}
+
+	for (TPair<int32, FAnalogInputState>& AnalogInputState : AnalogInputStates)
 	{
-		switch (CountdownPhase)
+		if (AnalogInputState.Value.bReceivedInput)
 		{
-			case ECountdownPhase::First:
-				TimerCounter += DeltaTime;
-				if (TimerCounter >= InputHeldWaitTime)
-				{
-					NavigateInDirection(CallbackDirection);
-					TimerCounter -= InputHeldWaitTime;
-					CountdownPhase = ECountdownPhase::Looping;
-				}
-				break;
-			case ECountdownPhase::Looping:
-				TimerCounter += DeltaTime;
-				if (TimerCounter >= NavigationChainFrequency)
-				{
-					NavigateInDirection(CallbackDirection);
-					TimerCounter -= NavigationChainFrequency;
-				}
-				break;
+			ProcessAnalogInputState(AnalogInputState.Value);
+			AnalogInputState.Value.ResetReceivedInput();
 		}
 	}
 
+	TickRightThumbstickScroll(DeltaTime);
+
 	if (!bReceivedAnalogInput)
 	{
 		if (ThumbstickDelta != FVector2D::ZeroVector)
@@ -319,13 +347,34 @@ void UUINavPCComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 
 void UUINavPCComponent::RequestRebuildMappings()
 {
-	UEnhancedInputLibrary::ForEachSubsystem([](IEnhancedInputSubsystemInterface* Subsystem)
+	if (RebuildMappingsHandle.IsValid())
 	{
-		if (Subsystem)
-		{
-			Subsystem->RequestRebuildControlMappings();
-		}
-	});
+		return;
+	}
+
+	RebuildMappingsHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UUINavPCComponent::FlushRebuildMappings);
+}
+
+void UUINavPCComponent::FlushRebuildMappings()
+{
+	if (!RebuildMappingsHandle.IsValid())
+	{
+		return;
+	}
+
+	FCoreDelegates::OnEndFrame.Remove(RebuildMappingsHandle);
+	RebuildMappingsHandle.Reset();
+
+	if (!IsValid(PC))
+	{
+		return;
+	}
+
+	UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer());
+	if (IsValid(Subsystem))
+	{
+		Subsystem->RequestRebuildControlMappings();
+	}
 }
 
 void UUINavPCComponent::AddInputContextFromUINavWidget(UUINavWidget* UINavWidget, const UUINavWidget* const ParentLimit /*= nullptr*/)
@@ -399,7 +448,7 @@ void UUINavPCComponent::AddInputContext(const UInputMappingContext* const Contex
 		return;
 	}
 
-	InputSubsystem->AddMappingContext(Context, Priority);
+	InputSubsystem->AddMappingContext(GetPlayerInputContext(Context), Priority);
 }
 
 void UUINavPCComponent::RemoveInputContext(const UInputMappingContext* const Context)
@@ -410,7 +459,13 @@ void UUINavPCComponent::RemoveInputContext(const UInputMappingContext* const Con
 		return;
 	}
 
-	InputSubsystem->RemoveMappingContext(Context);
+	InputSubsystem->RemoveMappingContext(GetPlayerInputContext(Context));
+}
+
+const UInputMappingContext* UUINavPCComponent::GetPlayerInputContext(const UInputMappingContext* const Context) const
+{
+	UUINavLocalPlayerSubsystem* UINavLocalPlayerSubsystem = IsValid(PC) ? ULocalPlayer::GetSubsystem<UUINavLocalPlayerSubsystem>(PC->GetLocalPlayer()) : nullptr;
+	return IsValid(UINavLocalPlayerSubsystem) ? UINavLocalPlayerSubsystem->GetPlayerInputContext(Context) : Context;
 }
 
 void UUINavPCComponent::OnControllerConnectionChanged(EInputDeviceConnectionState NewConnectionState, FPlatformUserId UserId, FInputDeviceId UserIndex)
@@ -451,7 +506,7 @@ void UUINavPCComponent::BindNavigationInputs()
 		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuSelect, ETriggerEvent::Started, this, &UUINavPCComponent::SimulateStartSelect).GetHandle());
 		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuSelect, ETriggerEvent::Completed, this, &UUINavPCComponent::SimulateStopSelect).GetHandle());
 
-		const UInputMappingContext* const UINavContext = GetUINavInputContext(ActiveWidget);
+		const UInputMappingContext* const UINavContext = GetPlayerInputContext(GetUINavInputContext(ActiveWidget));
 		if (IsValid(UINavContext))
 		{
 			for (const FEnhancedActionKeyMapping& ActionMapping : UINavContext->GetMappings())
@@ -751,6 +806,8 @@ void UUINavPCComponent::SetActiveWidget(UUINavWidget * NewActiveWidget)
 {
 	if (NewActiveWidget == ActiveWidget || !IsValid(PC)) return;
 
+	FUINavInputRecorder::Get().NotifyActiveWidgetChanged(NewActiveWidget);
+
 	if (ActiveWidget != nullptr)
 	{
 		if (NewActiveWidget == nullptr)
@@ -919,13 +976,101 @@ UUINavWidget* UUINavPCComponent::GoToPromptWidget(TSubclassOf<UUINavPromptWidget
 		return nullptr;
 	}
 
-	UUINavPromptWidget* NewWidget = CreateWidget<UUINavPromptWidget>(PC, NewWidgetClass);
+	UUINavPromptWidget* NewWidget = AcquirePromptWidget(NewWidgetClass);
+	if (NewWidget == nullptr)
+	{
+		return nullptr;
+	}
+
 	NewWidget->Title = Title;
 	NewWidget->Message = Message;
 	NewWidget->SetCallback(Event);
 	return GoToBuiltWidget(NewWidget, bRemoveParent, false, ZOrder);
 }
 
+UUINavPromptWidget* UUINavPCComponent::AcquirePromptWidget(TSubclassOf<UUINavPromptWidget> WidgetClass)
+{
+	if (WidgetClass == nullptr)
+	{
+		return nullptr;
+	}
+
+	for (int32 i = PooledPromptWidgets.Num() - 1; i >= 0; --i)
+	{
+		UUINavPromptWidget* const PooledWidget = PooledPromptWidgets[i];
+		if (!IsValid(PooledWidget))
+		{
+			PooledPromptWidgets.RemoveAtSwap(i);
+			continue;
+		}
+
+		if (PooledWidget->GetClass() == WidgetClass)
+		{
+			PooledPromptWidgets.RemoveAtSwap(i);
+			return PooledWidget;
+		}
+	}
+
+	return CreateWidget<UUINavPromptWidget>(PC, WidgetClass);
+}
+
+void UUINavPCComponent::ReleasePromptWidget(UUINavPromptWidget* Widget)
+{
+	if (!IsValid(Widget) || Widget == ActiveWidget || Widget->IsInViewport() || Widget->GetParent() != nullptr)
+	{
+		return;
+	}
+
+	if (PooledPromptWidgets.Contains(Widget) ||
+		GetNumPooledPromptWidgets(Widget->GetClass()) >= GetDefault<UUINavSettings>()->MaxPooledPromptWidgets)
+	{
+		return;
+	}
+
+	Widget->ResetPromptState();
+	PooledPromptWidgets.Add(Widget);
+}
+
+void UUINavPCComponent::PrewarmPromptWidgets(TSubclassOf<UUINavPromptWidget> WidgetClass, const int32 Count)
+{
+	if (WidgetClass == nullptr)
+	{
+		DISPLAYERROR("PrewarmPromptWidgets: No Widget Class found");
+		return;
+	}
+
+	const int32 TargetCount = FMath::Min(Count, GetDefault<UUINavSettings>()->MaxPooledPromptWidgets);
+	for (int32 PooledCount = GetNumPooledPromptWidgets(WidgetClass); PooledCount < TargetCount; ++PooledCount)
+	{
+		UUINavPromptWidget* const NewWidget = CreateWidget<UUINavPromptWidget>(PC, WidgetClass);
+		if (NewWidget == nullptr)
+		{
+			return;
+		}
+
+		NewWidget->PrewarmPromptData();
+		PooledPromptWidgets.Add(NewWidget);
+	}
+}
+
+void UUINavPCComponent::ClearPromptWidgetPool()
+{
+	PooledPromptWidgets.Reset();
+}
+
+int32 UUINavPCComponent::GetNumPooledPromptWidgets(TSubclassOf<UUINavPromptWidget> WidgetClass) const
+{
+	int32 Count = 0;
+	for (const UUINavPromptWidget* const PooledWidget : PooledPromptWidgets)
+	{
+		if (IsValid(PooledWidget) && PooledWidget->GetClass() == WidgetClass)
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
+
 UUINavWidget* UUINavPCComponent::GoToBuiltWidget(UUINavWidget* NewWidget, const bool bRemoveParent, const bool bDestroyParent, const int ZOrder)
 {
 	if (NewWidget == nullptr) return nullptr;
@@ -995,6 +1140,9 @@ bool UUINavPCComponent::ShouldHideMouseCursor() const
 
 void UUINavPCComponent::RefreshNavigationKeys()
 {
+	SCOPE_CYCLE_COUNTER(STAT_UINavRefreshNavigationKeys);
+	UINAV_TRACE_SCOPE(UUINavPCComponent::RefreshNavigationKeys);
+
 	if (bWaitingForInputCooldown)
 	{
 		FSlateApplication::Get().SetNavigationConfig(
@@ -1182,113 +1330,202 @@ void UUINavPCComponent::HandleKeyUpEvent(FSlateApplication& SlateApp, const FKey
 
 void UUINavPCComponent::HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent)
 {
+	SCOPE_CYCLE_COUNTER(STAT_UINavHandleAnalogInput);
+	UINAV_TRACE_SCOPE(UUINavPCComponent::HandleAnalogInputEvent);
+
 	if (!IsValid(ActiveWidget))
 	{
 		return;
 	}
 
-	if (CurrentInputType != EInputType::Gamepad && FMath::Abs(InAnalogInputEvent.GetAnalogValue()) > GetDefault<UUINavSettings>()->AnalogInputChangeThreshold)
-	{
-		NotifyInputTypeChange(EInputType::Gamepad);
-	}
+	FAnalogInputState& AnalogInputState = AnalogInputStates.FindOrAdd(InAnalogInputEvent.GetUserIndex());
+	const FKey AnalogKey = InAnalogInputEvent.GetKey();
+	const float AnalogValue = InAnalogInputEvent.GetAnalogValue();
 
-	TSharedRef<FUINavigationConfig> UINavConfig = StaticCastSharedRef<FUINavigationConfig>(FSlateApplication::Get().GetNavigationConfig());
-	FKey UsedAnalogKey;
-	if (InAnalogInputEvent.GetKey() == EKeys::Gamepad_LeftX)
+	if (AnalogKey == EKeys::Gamepad_LeftX || AnalogKey == EKeys::Gamepad_LeftY)
 	{
-		if (InAnalogInputEvent.GetAnalogValue() > UINavConfig->AnalogNavigationHorizontalThreshold)
+		// Slate may navigate with this event before the next tick, so the key used for that navigation has to be known right away
+		const TSharedRef<FUINavigationConfig> UINavConfig = StaticCastSharedRef<FUINavigationConfig>(FSlateApplication::Get().GetNavigationConfig());
+		FKey UsedAnalogKey;
+		if (AnalogKey == EKeys::Gamepad_LeftX)
 		{
-			UsedAnalogKey = EKeys::Gamepad_LeftStick_Right;
+			AnalogInputState.LeftStick.X = AnalogValue;
+			AnalogInputState.bReceivedLeftX = true;
+
+			if (AnalogValue > UINavConfig->AnalogNavigationHorizontalThreshold)
+			{
+				UsedAnalogKey = EKeys::Gamepad_LeftStick_Right;
+			}
+			else if (AnalogValue < -UINavConfig->AnalogNavigationHorizontalThreshold)
+			{
+				UsedAnalogKey = EKeys::Gamepad_LeftStick_Left;
+			}
 		}
-		else if (InAnalogInputEvent.GetAnalogValue() < -UINavConfig->AnalogNavigationHorizontalThreshold)
+		else
 		{
-			UsedAnalogKey = EKeys::Gamepad_LeftStick_Left;
+			AnalogInputState.LeftStick.Y = AnalogValue;
+			AnalogInputState.bReceivedLeftY = true;
+
+			if (AnalogValue > UINavConfig->AnalogNavigationVerticalThreshold)
+			{
+				UsedAnalogKey = EKeys::Gamepad_LeftStick_Up;
+			}
+			else if (AnalogValue < -UINavConfig->AnalogNavigationVerticalThreshold)
+			{
+				UsedAnalogKey = EKeys::Gamepad_LeftStick_Down;
+			}
 		}
-	}
-	else if (InAnalogInputEvent.GetKey() == EKeys::Gamepad_LeftY)
-	{
-		if (InAnalogInputEvent.GetAnalogValue() > UINavConfig->AnalogNavigationVerticalThreshold)
+
+		if (UsedAnalogKey.IsValid())
 		{
-			UsedAnalogKey = EKeys::Gamepad_LeftStick_Up;
+			LastPressedKey = UsedAnalogKey;
+
+			// Keep the first event past the threshold, since Slate navigates once the stick crosses it
+			StampNavigationInput(/*bOverwrite*/ false);
 		}
-		else if (InAnalogInputEvent.GetAnalogValue() < -UINavConfig->AnalogNavigationVerticalThreshold)
+		else if (FMath::Abs(AnalogInputState.LeftStick.X) <= UINavConfig->AnalogNavigationHorizontalThreshold &&
+			FMath::Abs(AnalogInputState.LeftStick.Y) <= UINavConfig->AnalogNavigationVerticalThreshold)
 		{
-			UsedAnalogKey = EKeys::Gamepad_LeftStick_Down;
+			// The stick is back inside the navigation thresholds, so its stamp belongs to a movement that didn't navigate
+			ClearNavigationInputStamp();
 		}
 	}
-
-	if (UsedAnalogKey.IsValid() && LastPressedKey != UsedAnalogKey)
+	else if (AnalogKey == EKeys::Gamepad_RightX)
+	{
+		AnalogInputState.RightStick.X = AnalogValue;
+		AnalogInputState.bReceivedRightX = true;
+	}
+	else if (AnalogKey == EKeys::Gamepad_RightY)
 	{
-		LastPressedKey = UsedAnalogKey;
+		AnalogInputState.RightStick.Y = AnalogValue;
+		AnalogInputState.bReceivedRightY = true;
 	}
 
-	const UWorld* const World = GetWorld();
-	if (!IsValid(World))
+	AnalogInputState.MaxAnalogValue = FMath::Max(AnalogInputState.MaxAnalogValue, FMath::Abs(AnalogValue));
+	AnalogInputState.bReceivedInput = true;
+}
+
+void UUINavPCComponent::ProcessAnalogInputState(const FAnalogInputState& AnalogInputState)
+{
+	if (!IsValid(ActiveWidget))
 	{
 		return;
 	}
 
+	if (CurrentInputType != EInputType::Gamepad && AnalogInputState.MaxAnalogValue > GetDefault<UUINavSettings>()->AnalogInputChangeThreshold)
+	{
+		NotifyInputTypeChange(EInputType::Gamepad);
+	}
+
 	if (bWaitingForInputCooldown)
 	{
 		return;
 	}
 
 	const EThumbstickAsMouse ThumbstickAsMouse = UsingThumbstickAsMouse();
-	const FKey AnalogKey = InAnalogInputEvent.GetKey();
-	const bool bConsiderLeftStick = ThumbstickAsMouse == EThumbstickAsMouse::LeftThumbstick && (AnalogKey == EKeys::Gamepad_LeftX || AnalogKey == EKeys::Gamepad_LeftY);
-	const bool bConsiderRightStick = ThumbstickAsMouse == EThumbstickAsMouse::RightThumbstick && (AnalogKey == EKeys::Gamepad_RightX || AnalogKey == EKeys::Gamepad_RightY);
-	const float AnalogValue = InAnalogInputEvent.GetAnalogValue();
+	const bool bConsiderLeftStick = ThumbstickAsMouse == EThumbstickAsMouse::LeftThumbstick && (AnalogInputState.bReceivedLeftX || AnalogInputState.bReceivedLeftY);
+	const bool bConsiderRightStick = ThumbstickAsMouse == EThumbstickAsMouse::RightThumbstick && (AnalogInputState.bReceivedRightX || AnalogInputState.bReceivedRightY);
+
+	if (!bConsiderLeftStick && !bConsiderRightStick)
+	{
+		return;
+	}
 
-	if (bScrollWithRightThumbstick &&
-		ThumbstickAsMouse != EThumbstickAsMouse::RightThumbstick &&
-		AnalogKey == EKeys::Gamepad_RightY &&
-		FMath::Abs(AnalogValue) >= RightThumbstickScrollDeadzone)
+	if (bConsiderLeftStick)
 	{
-		const float ScrollAmount = -AnalogValue * RightThumbstickScrollSensitivity * 10.0f * World->DeltaTimeSeconds;
-		if (IsValid(ActiveWidget))
+		if (AnalogInputState.bReceivedLeftX) ThumbstickDelta.X = AnalogInputState.LeftStick.X;
+		if (AnalogInputState.bReceivedLeftY) ThumbstickDelta.Y = AnalogInputState.LeftStick.Y;
+	}
+	else
+	{
+		if (AnalogInputState.bReceivedRightX) ThumbstickDelta.X = AnalogInputState.RightStick.X;
+		if (AnalogInputState.bReceivedRightY) ThumbstickDelta.Y = AnalogInputState.RightStick.Y;
+	}
+
+	if (ThumbstickDelta == FVector2D::ZeroVector)
+	{
+		RefreshNavigationKeys();
+	}
+	bReceivedAnalogInput = true;
+}
+
+void UUINavPCComponent::TickRightThumbstickScroll(const float DeltaTime)
+{
+	// The stick's position persists between analog events, so a stick held still keeps scrolling
+	float ScrollInput = 0.0f;
+	if (bScrollWithRightThumbstick && !bWaitingForInputCooldown && UsingThumbstickAsMouse() != EThumbstickAsMouse::RightThumbstick)
+	{
+		for (const TPair<int32, FAnalogInputState>& AnalogInputState : AnalogInputStates)
 		{
-			const UUINavComponent* const CurrentUINavComponent = ActiveWidget->GetCurrentComponent();
-			if (IsValid(CurrentUINavComponent))
+			const float StickY = AnalogInputState.Value.RightStick.Y;
+			if (FMath::Abs(StickY) >= RightThumbstickScrollDeadzone && FMath::Abs(StickY) > FMath::Abs(ScrollInput))
 			{
-				UScrollBox* ParentScrollBox = ActiveWidget->GetScrollBoxToFocus();
-				if (!IsValid(ParentScrollBox))
-				{
-					ParentScrollBox = CurrentUINavComponent->GetParentScrollBox();
-				}
+				ScrollInput = StickY;
+			}
+		}
+	}
 
-				if (IsValid(ParentScrollBox))
-				{
-					const float CurrentScrollOffset = ParentScrollBox->GetScrollOffset();
-					const float ScrollOffsetOfEnd = ParentScrollBox->GetScrollOffsetOfEnd();
-					const float NewScrollOffset = FMath::Clamp(CurrentScrollOffset + ScrollAmount, 0.0f, ScrollOffsetOfEnd);
-					
-					ParentScrollBox->SetScrollOffset(NewScrollOffset);
-					if (CurrentScrollOffset != NewScrollOffset)
-					{
-						ParentScrollBox->OnUserScrolled.Broadcast(NewScrollOffset);
-					}
-				}
+	if (ScrollInput != 0.0f)
+	{
+		UScrollBox* ParentScrollBox = nullptr;
+		const UUINavComponent* const CurrentUINavComponent = IsValid(ActiveWidget) ? ActiveWidget->GetCurrentComponent() : nullptr;
+		if (IsValid(CurrentUINavComponent))
+		{
+			ParentScrollBox = ActiveWidget->GetScrollBoxToFocus();
+			if (!IsValid(ParentScrollBox))
+			{
+				ParentScrollBox = CurrentUINavComponent->GetParentScrollBox();
 			}
 		}
+
+		if (RightThumbstickScrollBox.Get() != ParentScrollBox)
+		{
+			RightThumbstickScrollBox = ParentScrollBox;
+			RightThumbstickScrollVelocity = 0.0f;
+		}
+
+		const float ScrollInputSize = FMath::Abs(ScrollInput);
+		const float ScrollResponse = IsValid(RightThumbstickScrollCurve) ? RightThumbstickScrollCurve->GetFloatValue(ScrollInputSize) : ScrollInputSize;
+		const float TargetVelocity = -FMath::Sign(ScrollInput) * ScrollResponse * RightThumbstickScrollSensitivity * 10.0f;
+
+		// Frame rate independent approach towards the stick's speed
+		RightThumbstickScrollVelocity = RightThumbstickScrollAcceleration > 0.0f ?
+			FMath::Lerp(RightThumbstickScrollVelocity, TargetVelocity, 1.0f - FMath::Exp(-RightThumbstickScrollAcceleration * DeltaTime)) :
+			TargetVelocity;
+	}
+	else if (RightThumbstickScrollVelocity != 0.0f)
+	{
+		RightThumbstickScrollVelocity = RightThumbstickScrollDamping > 0.0f ? RightThumbstickScrollVelocity * FMath::Exp(-RightThumbstickScrollDamping * DeltaTime) : 0.0f;
+		if (FMath::Abs(RightThumbstickScrollVelocity) < 1.0f)
+		{
+			RightThumbstickScrollVelocity = 0.0f;
+		}
 	}
 
-	if (!bConsiderLeftStick && !bConsiderRightStick)
+	if (RightThumbstickScrollVelocity == 0.0f)
+	{
+		return;
+	}
+
+	UScrollBox* const ScrollBox = RightThumbstickScrollBox.Get();
+	if (!IsValid(ScrollBox))
 	{
+		RightThumbstickScrollVelocity = 0.0f;
 		return;
 	}
 
-	const bool bIsHorizontal = AnalogKey == EKeys::Gamepad_LeftX || AnalogKey == EKeys::Gamepad_RightX;
-	if (bIsHorizontal) ThumbstickDelta.X = AnalogValue;
-	else ThumbstickDelta.Y = AnalogValue;
+	const float CurrentScrollOffset = ScrollBox->GetScrollOffset();
+	const float ScrollOffsetOfEnd = ScrollBox->GetScrollOffsetOfEnd();
+	const float NewScrollOffset = FMath::Clamp(CurrentScrollOffset + RightThumbstickScrollVelocity * DeltaTime, 0.0f, ScrollOffsetOfEnd);
 
-	if (bConsiderLeftStick || bConsiderRightStick)
+	if (CurrentScrollOffset == NewScrollOffset)
 	{
-		if (ThumbstickDelta == FVector2D::ZeroVector)
-		{
-			RefreshNavigationKeys();
-		}
-		bReceivedAnalogInput = true;
+		RightThumbstickScrollVelocity = 0.0f;
+		return;
 	}
+
+	ScrollBox->SetScrollOffset(NewScrollOffset);
+	ScrollBox->OnUserScrolled.Broadcast(NewScrollOffset);
 }
 
 void UUINavPCComponent::HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
@@ -1461,6 +1698,7 @@ FKey UUINavPCComponent::GetMostRecentlyPressedKey(const ENavigationGenesis Genes
 void UUINavPCComponent::SetTimer(const EUINavigation TimerDirection)
 {
 	TimerCounter = 0.f;
+	ChainHeldTime = 0.f;
 	CallbackDirection = TimerDirection;
 	CountdownPhase = ECountdownPhase::First;
 }
@@ -1470,79 +1708,291 @@ void UUINavPCComponent::ClearNavigationTimer()
 	if (CallbackDirection == EUINavigation::Invalid) return;
 
 	TimerCounter = 0.f;
+	ChainHeldTime = 0.f;
 	CallbackDirection = EUINavigation::Invalid;
 	CountdownPhase = ECountdownPhase::None;
 }
 
-bool UUINavPCComponent::IsWidgetActive(const UUINavWidget* const UINavWidget) const
+void UUINavPCComponent::TickNavigationChain(const float DeltaTime)
 {
-	if (!IsValid(ActiveWidget))
+	TimerCounter += DeltaTime;
+	ChainHeldTime += DeltaTime;
+
+	int32 NumSteps = 0;
+	if (CountdownPhase == ECountdownPhase::First)
 	{
-		return false;
+		if (TimerCounter < InputHeldWaitTime)
+		{
+			return;
+		}
+
+		TimerCounter -= InputHeldWaitTime;
+		CountdownPhase = ECountdownPhase::Looping;
+		NumSteps++;
 	}
 
-	if (ActiveWidget == UINavWidget)
+	// Emit every step that became due this frame, so that low frame rates don't slow down the chain
+	const float ChainInterval = GetNavigationChainInterval();
+	if (ChainInterval > 0.0f && TimerCounter >= ChainInterval)
 	{
-		return true;
+		const int32 NumLoopingSteps = FMath::FloorToInt(TimerCounter / ChainInterval);
+		TimerCounter -= NumLoopingSteps * ChainInterval;
+		NumSteps += NumLoopingSteps;
 	}
 
-	for (const UUINavWidget* const ChildUINavWidget : UINavWidget->ChildUINavWidgets)
+	if (NumSteps == 0)
 	{
-		if (!IsValid(ChildUINavWidget))
-		{
-			continue;
-		}
+		return;
+	}
 
-		if (IsWidgetActive(ChildUINavWidget))
+	// Chained navigations repeat a held input, so they aren't sampled for latency
+	ClearNavigationInputStamp();
+
+	const EUINavigation Direction = CallbackDirection;
+	if (NumSteps > MaxChainStepsPerFrame)
+	{
+		if (bUseChainPageSteps && TryNavigatePageInDirection(Direction, NumSteps))
 		{
-			return true;
+			return;
 		}
+
+		NumSteps = FMath::Max(MaxChainStepsPerFrame, 1);
 	}
 
-	return false;
+	for (int32 i = 0; i < NumSteps && CallbackDirection == Direction; ++i)
+	{
+		NavigateInDirection(Direction);
+	}
 }
 
-bool UUINavPCComponent::IsWidgetChild(const UUINavWidget* const ParentWidget, const UUINavWidget* const ChildWidget) const
+float UUINavPCComponent::GetNavigationChainInterval() const
 {
-	if (!IsValid(ParentWidget) || !IsValid(ChildWidget))
+	const float AccelerationTime = ChainHeldTime - InputHeldWaitTime - ChainAccelerationDelay;
+	if (!IsValid(ChainAccelerationCurve) || AccelerationTime <= 0.0f)
+	{
+		return NavigationChainFrequency;
+	}
+
+	const float Multiplier = ChainAccelerationCurve->GetFloatValue(AccelerationTime);
+	return Multiplier > 0.0f ? NavigationChainFrequency / Multiplier : NavigationChainFrequency;
+}
+
+bool UUINavPCComponent::TryNavigatePageInDirection(const EUINavigation Direction, const int32 NumSteps)
+{
+	if (!IsValid(ActiveWidget))
 	{
 		return false;
 	}
 
-	for (const UUINavWidget* const ChildUINavWidget : ParentWidget->ChildUINavWidgets)
+	UUINavComponent* const CurrentUINavComponent = ActiveWidget->GetCurrentComponent();
+	if (!IsValid(CurrentUINavComponent))
 	{
-		if (!IsValid(ChildUINavWidget))
+		return false;
+	}
+
+	UPanelWidget* const ParentPanel = CurrentUINavComponent->GetParent();
+	if (!IsValid(ParentPanel))
+	{
+		return false;
+	}
+
+	const auto IsPageDestination = [](const UUINavComponent* const Component)
+	{
+		return IsValid(Component) && Component->IsVisible() && Component->GetIsEnabled() && Component->IsFocusable();
+	};
+
+	const auto GetGridCell = [](const UWidget* const Widget, int32& OutRow, int32& OutColumn)
+	{
+		if (const UUniformGridSlot* const UniformGridSlot = Cast<UUniformGridSlot>(Widget->Slot))
 		{
-			continue;
+			OutRow = UniformGridSlot->GetRow();
+			OutColumn = UniformGridSlot->GetColumn();
+			return true;
 		}
 
-		if (ChildUINavWidget == ChildWidget ||
-			IsWidgetChild(ChildUINavWidget, ChildWidget))
+		if (const UGridSlot* const GridSlot = Cast<UGridSlot>(Widget->Slot))
 		{
+			OutRow = GridSlot->GetRow();
+			OutColumn = GridSlot->GetColumn();
 			return true;
 		}
-	}
 
-	return false;
-}
+		return false;
+	};
 
-FKey UUINavPCComponent::GetEnhancedInputKey(const UInputAction* Action, const EInputAxis Axis, const EAxisType Scale, const EInputRestriction InputRestriction) const
-{
-	if (!IsValid(PC))
-	{
-		return FKey();
-	}
+	UUINavComponent* TargetComponent = nullptr;
 
-	if (UUINavBlueprintFunctionLibrary::IsUINavInputAction(Action))
+	const bool bIsVerticalDirection = Direction == EUINavigation::Up || Direction == EUINavigation::Down;
+	const bool bIsHorizontalDirection = Direction == EUINavigation::Left || Direction == EUINavigation::Right;
+	int32 CurrentRow = 0;
+	int32 CurrentColumn = 0;
+	if ((bIsVerticalDirection || bIsHorizontalDirection) && GetGridCell(CurrentUINavComponent, CurrentRow, CurrentColumn))
 	{
-		const UInputMappingContext* const UINavInputContext = GetDefault<UUINavSettings>()->EnhancedInputContext.LoadSynchronous();
-		for (const FEnhancedActionKeyMapping& Mapping : UINavInputContext->GetMappings())
+		// Jump to the farthest component within NumSteps cells in the current row or column
+		const int32 StepSign = Direction == EUINavigation::Up || Direction == EUINavigation::Left ? -1 : 1;
+		int32 TargetDistance = 0;
+		for (int32 i = 0; i < ParentPanel->GetChildrenCount(); ++i)
 		{
-			if (Mapping.Action == Action && UUINavBlueprintFunctionLibrary::RespectsRestriction(Mapping.Key, InputRestriction))
+			UUINavComponent* const Candidate = Cast<UUINavComponent>(ParentPanel->GetChildAt(i));
+			int32 Row = 0;
+			int32 Column = 0;
+			if (!IsPageDestination(Candidate) || !GetGridCell(Candidate, Row, Column))
 			{
-				if (Action->ValueType == EInputActionValueType::Boolean || Scale == EAxisType::None)
-				{
-					return Mapping.Key;
+				continue;
+			}
+
+			if (bIsVerticalDirection ? Column != CurrentColumn : Row != CurrentRow)
+			{
+				continue;
+			}
+
+			const int32 Distance = (bIsVerticalDirection ? Row - CurrentRow : Column - CurrentColumn) * StepSign;
+			if (Distance > TargetDistance && Distance <= NumSteps)
+			{
+				TargetDistance = Distance;
+				TargetComponent = Candidate;
+			}
+		}
+	}
+	else
+	{
+		const UScrollBox* const ParentScrollBox = Cast<UScrollBox>(ParentPanel);
+		const bool bIsVerticalPanel = ParentPanel->IsA<UVerticalBox>() || (ParentScrollBox != nullptr && ParentScrollBox->GetOrientation() == Orient_Vertical);
+		const bool bIsHorizontalPanel = ParentPanel->IsA<UHorizontalBox>() || (ParentScrollBox != nullptr && ParentScrollBox->GetOrientation() == Orient_Horizontal);
+
+		int32 StepSign = 0;
+		switch (Direction)
+		{
+			case EUINavigation::Up:
+				StepSign = bIsVerticalPanel ? -1 : 0;
+				break;
+			case EUINavigation::Down:
+				StepSign = bIsVerticalPanel ? 1 : 0;
+				break;
+			case EUINavigation::Left:
+				StepSign = bIsHorizontalPanel ? -1 : 0;
+				break;
+			case EUINavigation::Right:
+				StepSign = bIsHorizontalPanel ? 1 : 0;
+				break;
+			case EUINavigation::Previous:
+				StepSign = -1;
+				break;
+			case EUINavigation::Next:
+				StepSign = 1;
+				break;
+			default:
+				break;
+		}
+
+		if (StepSign == 0)
+		{
+			return false;
+		}
+
+		const int32 CurrentIndex = ParentPanel->GetChildIndex(CurrentUINavComponent);
+		if (CurrentIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		for (int32 TargetIndex = FMath::Clamp(CurrentIndex + StepSign * NumSteps, 0, ParentPanel->GetChildrenCount() - 1); TargetIndex != CurrentIndex; TargetIndex -= StepSign)
+		{
+			UUINavComponent* const Candidate = Cast<UUINavComponent>(ParentPanel->GetChildAt(TargetIndex));
+			if (IsPageDestination(Candidate))
+			{
+				TargetComponent = Candidate;
+				break;
+			}
+		}
+	}
+
+	if (TargetComponent == nullptr)
+	{
+		return false;
+	}
+
+	// Perform the jump as a regular navigation, whose handling redirects it to the destination
+	PageNavigationDestination = TargetComponent;
+	NavigateInDirection(Direction);
+	PageNavigationDestination.Reset();
+	return true;
+}
+
+UUINavComponent* UUINavPCComponent::GetPageNavigationDestination() const
+{
+	return PageNavigationDestination.Get();
+}
+
+bool UUINavPCComponent::IsWidgetActive(const UUINavWidget* const UINavWidget) const
+{
+	if (!IsValid(ActiveWidget))
+	{
+		return false;
+	}
+
+	if (ActiveWidget == UINavWidget)
+	{
+		return true;
+	}
+
+	for (const UUINavWidget* const ChildUINavWidget : UINavWidget->ChildUINavWidgets)
+	{
+		if (!IsValid(ChildUINavWidget))
+		{
+			continue;
+		}
+
+		if (IsWidgetActive(ChildUINavWidget))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool UUINavPCComponent::IsWidgetChild(const UUINavWidget* const ParentWidget, const UUINavWidget* const ChildWidget) const
+{
+	if (!IsValid(ParentWidget) || !IsValid(ChildWidget))
+	{
+		return false;
+	}
+
+	for (const UUINavWidget* const ChildUINavWidget : ParentWidget->ChildUINavWidgets)
+	{
+		if (!IsValid(ChildUINavWidget))
+		{
+			continue;
+		}
+
+		if (ChildUINavWidget == ChildWidget ||
+			IsWidgetChild(ChildUINavWidget, ChildWidget))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+FKey UUINavPCComponent::GetEnhancedInputKey(const UInputAction* Action, const EInputAxis Axis, const EAxisType Scale, const EInputRestriction InputRestriction) const
+{
+	if (!IsValid(PC))
+	{
+		return FKey();
+	}
+
+	if (UUINavBlueprintFunctionLibrary::IsUINavInputAction(Action))
+	{
+		const UInputMappingContext* const UINavInputContext = GetPlayerInputContext(GetDefault<UUINavSettings>()->EnhancedInputContext.LoadSynchronous());
+		for (const FEnhancedActionKeyMapping& Mapping : UINavInputContext->GetMappings())
+		{
+			if (Mapping.Action == Action && UUINavBlueprintFunctionLibrary::RespectsRestriction(Mapping.Key, InputRestriction))
+			{
+				if (Action->ValueType == EInputActionValueType::Boolean || Scale == EAxisType::None)
+				{
+					return Mapping.Key;
 				}
 				else
 				{
@@ -1570,10 +2020,14 @@ FKey UUINavPCComponent::GetEnhancedInputKey(const UInputAction* Action, const EI
 		}
 	}
 
-	for (const UInputMappingContext* const InputContext : CachedInputContexts)
+	// Read this player's copy of each input context, so that another player's rebinds aren't reported
+	for (const UInputMappingContext* const CachedInputContext : CachedInputContexts)
 	{
-		for (const FEnhancedActionKeyMapping& Mapping : InputContext->GetMappings())
+		const UInputMappingContext* const InputContext = GetPlayerInputContext(CachedInputContext);
+		const TArray<FEnhancedActionKeyMapping>& Mappings = InputContext->GetMappings();
+		for (int32 MappingIndex = 0; MappingIndex < Mappings.Num(); ++MappingIndex)
 		{
+			const FEnhancedActionKeyMapping& Mapping = Mappings[MappingIndex];
 			if (Mapping.Action == Action && UUINavBlueprintFunctionLibrary::RespectsRestriction(Mapping.Key, InputRestriction))
 			{
 				if (Action->ValueType == EInputActionValueType::Boolean || Scale == EAxisType::None)
@@ -1589,8 +2043,8 @@ FKey UUINavPCComponent::GetEnhancedInputKey(const UInputAction* Action, const EI
 					else
 					{
 						bool bPositive;
-						EInputAxis KeyAxis;
-						GetAxisPropertiesFromMapping(Mapping, bPositive, KeyAxis);
+						EInputAxis KeyAxis = EInputAxis::X;
+						GetAxisPropertiesFromMapping(InputContext, MappingIndex, bPositive, KeyAxis);
 						if (KeyAxis == Axis && bPositive == (Scale == EAxisType::Positive))
 						{
 							return Mapping.Key;
@@ -1675,7 +2129,7 @@ void UUINavPCComponent::GetEnhancedInputKeys(const UInputAction* Action, TArray<
 {
 	if (UUINavBlueprintFunctionLibrary::IsUINavInputAction(Action))
 	{
-		const UInputMappingContext* const UINavInputContext = GetDefault<UUINavSettings>()->EnhancedInputContext.LoadSynchronous();
+		const UInputMappingContext* const UINavInputContext = GetPlayerInputContext(GetDefault<UUINavSettings>()->EnhancedInputContext.LoadSynchronous());
 		for (const FEnhancedActionKeyMapping& Mapping : UINavInputContext->GetMappings())
 		{
 			if (Mapping.Action == Action && UUINavBlueprintFunctionLibrary::RespectsRestriction(Mapping.Key, EInputRestriction::None))
@@ -1694,9 +2148,9 @@ void UUINavPCComponent::GetEnhancedInputKeys(const UInputAction* Action, TArray<
 		return;
 	}
 
-	for (const UInputMappingContext* const InputContext : CachedInputContexts)
+	for (const UInputMappingContext* const CachedInputContext : CachedInputContexts)
 	{
-		for (const FEnhancedActionKeyMapping& Mapping : InputContext->GetMappings())
+		for (const FEnhancedActionKeyMapping& Mapping : GetPlayerInputContext(CachedInputContext)->GetMappings())
 		{
 			if (Mapping.Action == Action)
 			{
@@ -1722,12 +2176,101 @@ EInputType UUINavPCComponent::GetKeyInputType(const FKey& Key)
 	}
 }
 
+struct UUINavPCComponent::FAxisKeyRelations
+{
+	struct FScaledKeyAxis
+	{
+		FKey Axis;
+		FKey OppositeKey;
+		bool bPositive = true;
+	};
+
+	struct FAxis1DRelation
+	{
+		FKey Axis2D;
+		FKey OppositeAxis;
+	};
+
+	TMap<FKey, FAxis2D_Keys> Axis2DToAxis1DMap = {
+		{EKeys::Gamepad_Left2D, {EKeys::Gamepad_LeftX, EKeys::Gamepad_LeftY}},
+		{EKeys::Gamepad_Right2D, {EKeys::Gamepad_RightX, EKeys::Gamepad_RightY}},
+		{EKeys::Mouse2D, {EKeys::MouseX, EKeys::MouseY}},
+	};
+
+	TMap<FKey, FAxis2D_Keys> AxisToKeyMap = {
+		{EKeys::Gamepad_LeftX, {EKeys::Gamepad_LeftStick_Right, EKeys::Gamepad_LeftStick_Left}},
+		{EKeys::Gamepad_LeftY, {EKeys::Gamepad_LeftStick_Up, EKeys::Gamepad_LeftStick_Down}},
+		{EKeys::Gamepad_RightX, {EKeys::Gamepad_RightStick_Right, EKeys::Gamepad_RightStick_Left}},
+		{EKeys::Gamepad_RightY, {EKeys::Gamepad_RightStick_Up, EKeys::Gamepad_RightStick_Down}},
+		{EKeys::MouseX, {MouseRight, MouseLeft}},
+		{EKeys::MouseY, {MouseUp, MouseDown}},
+		{EKeys::MouseWheelAxis, {EKeys::MouseScrollUp, EKeys::MouseScrollDown}},
+		{EKeys::MixedReality_Left_Thumbstick_X, {EKeys::MixedReality_Left_Thumbstick_Right, EKeys::MixedReality_Left_Thumbstick_Left}},
+		{EKeys::MixedReality_Left_Thumbstick_Y, {EKeys::MixedReality_Left_Thumbstick_Up, EKeys::MixedReality_Left_Thumbstick_Down}},
+		{EKeys::MixedReality_Right_Thumbstick_X, {EKeys::MixedReality_Right_Thumbstick_Right, EKeys::MixedReality_Right_Thumbstick_Left}},
+		{EKeys::MixedReality_Right_Thumbstick_Y, {EKeys::MixedReality_Right_Thumbstick_Up, EKeys::MixedReality_Right_Thumbstick_Down}},
+		{EKeys::OculusTouch_Left_Thumbstick_X, {EKeys::OculusTouch_Left_Thumbstick_Right, EKeys::OculusTouch_Left_Thumbstick_Left}},
+		{EKeys::OculusTouch_Left_Thumbstick_Y, {EKeys::OculusTouch_Left_Thumbstick_Up, EKeys::OculusTouch_Left_Thumbstick_Down}},
+		{EKeys::OculusTouch_Right_Thumbstick_X, {EKeys::OculusTouch_Right_Thumbstick_Right, EKeys::OculusTouch_Right_Thumbstick_Left}},
+		{EKeys::OculusTouch_Right_Thumbstick_Y, {EKeys::OculusTouch_Right_Thumbstick_Up, EKeys::OculusTouch_Right_Thumbstick_Down}},
+		{EKeys::ValveIndex_Left_Thumbstick_X, {EKeys::ValveIndex_Left_Thumbstick_Right, EKeys::ValveIndex_Left_Thumbstick_Left}},
+		{EKeys::ValveIndex_Left_Thumbstick_Y, {EKeys::ValveIndex_Left_Thumbstick_Up, EKeys::ValveIndex_Left_Thumbstick_Down}},
+		{EKeys::ValveIndex_Right_Thumbstick_X, {EKeys::ValveIndex_Right_Thumbstick_Right, EKeys::ValveIndex_Right_Thumbstick_Left}},
+		{EKeys::ValveIndex_Right_Thumbstick_Y, {EKeys::ValveIndex_Right_Thumbstick_Up, EKeys::ValveIndex_Right_Thumbstick_Down}},
+		{EKeys::Vive_Left_Trackpad_X, {EKeys::Vive_Left_Trackpad_Right, EKeys::Vive_Left_Trackpad_Left}},
+		{EKeys::Vive_Left_Trackpad_Y, {EKeys::Vive_Left_Trackpad_Up, EKeys::Vive_Left_Trackpad_Down}},
+		{EKeys::Vive_Right_Trackpad_X, {EKeys::Vive_Right_Trackpad_Right, EKeys::Vive_Right_Trackpad_Left}},
+		{EKeys::Vive_Right_Trackpad_Y, {EKeys::Vive_Right_Trackpad_Up, EKeys::Vive_Right_Trackpad_Down}},
+	};
+
+	TMap<FKey, FKey> KeyToAxisMap = {
+		{EKeys::Gamepad_LeftTrigger, EKeys::Gamepad_LeftTriggerAxis},
+		{EKeys::Gamepad_RightTrigger, EKeys::Gamepad_RightTriggerAxis},
+		{EKeys::MixedReality_Left_Trigger_Click, EKeys::MixedReality_Left_Trigger_Axis},
+		{EKeys::MixedReality_Right_Trigger_Click, EKeys::MixedReality_Right_Trigger_Axis},
+		{EKeys::OculusTouch_Left_Grip_Click, EKeys::OculusTouch_Left_Grip_Axis},
+		{EKeys::OculusTouch_Right_Grip_Click, EKeys::OculusTouch_Right_Grip_Axis},
+		{EKeys::ValveIndex_Left_Trigger_Click, EKeys::ValveIndex_Left_Trigger_Axis},
+		{EKeys::ValveIndex_Right_Trigger_Click, EKeys::ValveIndex_Right_Trigger_Axis},
+		{EKeys::Vive_Left_Trigger_Click, EKeys::Vive_Left_Trigger_Axis},
+		{EKeys::Vive_Right_Trigger_Click, EKeys::Vive_Right_Trigger_Axis},
+	};
+
+	// Reverse of AxisToKeyMap: the axis of each directional key, along with the key in the opposite direction
+	TMap<FKey, FScaledKeyAxis> ScaledKeyToAxisMap;
+
+	// Reverse of Axis2DToAxis1DMap: the 2D axis of each 1D axis, along with the other 1D axis of that 2D axis
+	TMap<FKey, FAxis1DRelation> Axis1DToAxis2DMap;
+
+	FAxisKeyRelations()
+	{
+		for (const TPair<FKey, FAxis2D_Keys>& AxisKeys : AxisToKeyMap)
+		{
+			ScaledKeyToAxisMap.Add(AxisKeys.Value.PositiveKey, { AxisKeys.Key, AxisKeys.Value.NegativeKey, true });
+			ScaledKeyToAxisMap.Add(AxisKeys.Value.NegativeKey, { AxisKeys.Key, AxisKeys.Value.PositiveKey, false });
+		}
+
+		for (const TPair<FKey, FAxis2D_Keys>& Axis2DKeys : Axis2DToAxis1DMap)
+		{
+			Axis1DToAxis2DMap.Add(Axis2DKeys.Value.PositiveKey, { Axis2DKeys.Key, Axis2DKeys.Value.NegativeKey });
+			Axis1DToAxis2DMap.Add(Axis2DKeys.Value.NegativeKey, { Axis2DKeys.Key, Axis2DKeys.Value.PositiveKey });
+		}
+	}
+};
+
+const UUINavPCComponent::FAxisKeyRelations& UUINavPCComponent::GetAxisKeyRelations()
+{
+	static const FAxisKeyRelations AxisKeyRelations;
+	return AxisKeyRelations;
+}
+
 const FKey UUINavPCComponent::GetKeyFromAxis(const FKey& Key, const bool bPositive, const EInputAxis Axis) const
 {
-	const FAxis2D_Keys* Axis2DKeys = Axis2DToAxis1DMap.Find(Key);
+	const FAxisKeyRelations& AxisKeyRelations = GetAxisKeyRelations();
+	const FAxis2D_Keys* Axis2DKeys = AxisKeyRelations.Axis2DToAxis1DMap.Find(Key);
 	const FKey CheckedKey = Axis2DKeys == nullptr ? Key : (Axis == EInputAxis::X ? Axis2DKeys->PositiveKey : Axis2DKeys->NegativeKey);
 
-	const FAxis2D_Keys* AxisKeys = AxisToKeyMap.Find(CheckedKey);
+	const FAxis2D_Keys* AxisKeys = AxisKeyRelations.AxisToKeyMap.Find(CheckedKey);
 	if (AxisKeys == nullptr) return Key;
 
 	return bPositive ? AxisKeys->PositiveKey : AxisKeys->NegativeKey;
@@ -1735,25 +2278,17 @@ const FKey UUINavPCComponent::GetKeyFromAxis(const FKey& Key, const bool bPositi
 
 const FKey UUINavPCComponent::GetAxisFromScaledKey(const FKey& Key, const bool bInclude1DAxis, bool& OutbPositive) const
 {
-	for (const TPair<FKey, FAxis2D_Keys>& AxisKeys : AxisToKeyMap)
+	const FAxisKeyRelations::FScaledKeyAxis* ScaledKeyAxis = GetAxisKeyRelations().ScaledKeyToAxisMap.Find(Key);
+	if (ScaledKeyAxis != nullptr)
 	{
-		if (AxisKeys.Value.PositiveKey == Key)
-		{
-			OutbPositive = true;
-			return AxisKeys.Key;
-		}
-		
-		if (AxisKeys.Value.NegativeKey == Key)
-		{
-			OutbPositive = false;
-			return AxisKeys.Key;
-		}
+		OutbPositive = ScaledKeyAxis->bPositive;
+		return ScaledKeyAxis->Axis;
 	}
 
 	if (bInclude1DAxis)
 	{
-		return GetAxisFromKey(Key);
 		OutbPositive = true;
+		return GetAxisFromKey(Key);
 	}
 
 	return FKey();
@@ -1761,13 +2296,13 @@ const FKey UUINavPCComponent::GetAxisFromScaledKey(const FKey& Key, const bool b
 
 const FKey UUINavPCComponent::GetAxisFromKey(const FKey& Key) const
 {
-	const FKey* AxisKey = KeyToAxisMap.Find(Key);
+	const FKey* AxisKey = GetAxisKeyRelations().KeyToAxisMap.Find(Key);
 	return AxisKey == nullptr ? Key : *AxisKey;
 }
 
 const FKey UUINavPCComponent::GetAxis1DFromAxis2D(const FKey& Key, const EInputAxis Axis) const
 {
-	const FAxis2D_Keys* Axis2DKeys = Axis2DToAxis1DMap.Find(Key);
+	const FAxis2D_Keys* Axis2DKeys = GetAxisKeyRelations().Axis2DToAxis1DMap.Find(Key);
 	if (Axis2DKeys == nullptr) return FKey();
 
 	return Axis == EInputAxis::X ? Axis2DKeys->PositiveKey : Axis2DKeys->NegativeKey;
@@ -1775,104 +2310,178 @@ const FKey UUINavPCComponent::GetAxis1DFromAxis2D(const FKey& Key, const EInputA
 
 const FKey UUINavPCComponent::GetAxis2DFromAxis1D(const FKey& Key) const
 {
-	for (const TPair<FKey, FAxis2D_Keys>& AxisKeys : Axis2DToAxis1DMap)
+	const FAxisKeyRelations::FAxis1DRelation* Axis1DRelation = GetAxisKeyRelations().Axis1DToAxis2DMap.Find(Key);
+	return Axis1DRelation != nullptr ? Axis1DRelation->Axis2D : FKey();
+}
+
+const FKey UUINavPCComponent::GetOppositeAxisKey(const FKey& Key, bool& bOutIsPositive) const
+{
+	const FAxisKeyRelations::FScaledKeyAxis* ScaledKeyAxis = GetAxisKeyRelations().ScaledKeyToAxisMap.Find(Key);
+	if (ScaledKeyAxis == nullptr)
 	{
-		if (AxisKeys.Value.PositiveKey == Key) return AxisKeys.Key;
-		if (AxisKeys.Value.NegativeKey == Key) return AxisKeys.Key;
+		return FKey();
 	}
-	return FKey();
+
+	bOutIsPositive = !ScaledKeyAxis->bPositive;
+	return ScaledKeyAxis->OppositeKey;
 }
 
-const FKey UUINavPCComponent::GetOppositeAxisKey(const FKey& Key, bool& bOutIsPositive) const
+const FKey UUINavPCComponent::GetOppositeAxis2DAxis(const FKey& Key) const
 {
-	for (const TPair<FKey, FAxis2D_Keys>& AxisKeys : AxisToKeyMap)
+	const FAxisKeyRelations::FAxis1DRelation* Axis1DRelation = GetAxisKeyRelations().Axis1DToAxis2DMap.Find(Key);
+	return Axis1DRelation != nullptr ? Axis1DRelation->OppositeAxis : FKey();
+}
+
+FInputMappingDescriptor::FInputMappingDescriptor(const FEnhancedActionKeyMapping& Mapping)
+	: Key(Mapping.Key)
+	, Action(Mapping.Action)
+	, LastModifier(Mapping.Modifiers.Num() > 0 ? Mapping.Modifiers.Last().Get() : nullptr)
+	, FirstTrigger(Mapping.Triggers.Num() > 0 ? Mapping.Triggers[0].Get() : nullptr)
+	, NumModifiers(Mapping.Modifiers.Num())
+	, NumTriggers(Mapping.Triggers.Num())
+{
+	auto ReadModifiers = [this](const TArray<TObjectPtr<UInputModifier>>& Modifiers)
 	{
-		if (AxisKeys.Value.PositiveKey == Key)
+		for (const UInputModifier* Modifier : Modifiers)
 		{
-			bOutIsPositive = false;
-			return AxisKeys.Value.NegativeKey;
+			if (const UInputModifierSwizzleAxis* Swizzle = Cast<UInputModifierSwizzleAxis>(Modifier))
+			{
+				switch (Swizzle->Order)
+				{
+				case EInputAxisSwizzle::YXZ:
+				case EInputAxisSwizzle::YZX:
+					SwizzleAxis = EInputAxis::Y;
+					break;
+				case EInputAxisSwizzle::ZXY:
+				case EInputAxisSwizzle::ZYX:
+					SwizzleAxis = EInputAxis::Z;
+					break;
+				}
+			}
+			else if (const UInputModifierNegate* Negate = Cast<UInputModifierNegate>(Modifier))
+			{
+				// The last negate modifier wins
+				bHasNegate = true;
+				bNegateX = Negate->bX;
+				bNegateY = Negate->bY;
+				bNegateZ = Negate->bZ;
+			}
+
+			// TODO: Add support for Scalar input modifier
 		}
-		if (AxisKeys.Value.NegativeKey == Key)
+	};
+
+	ReadModifiers(Mapping.Modifiers);
+	for (const UInputModifier* Modifier : Mapping.Modifiers)
+	{
+		if (const UInputModifierNegate* Negate = Cast<UInputModifierNegate>(Modifier))
 		{
-			bOutIsPositive = true;
-			return AxisKeys.Value.PositiveKey;
+			MappingNegate = Negate;
+			bMappingNegateX = Negate->bX;
+			bMappingNegateY = Negate->bY;
+			bMappingNegateZ = Negate->bZ;
 		}
 	}
-	return FKey();
-}
 
-const FKey UUINavPCComponent::GetOppositeAxis2DAxis(const FKey& Key) const
-{
-	for (const TPair<FKey, FAxis2D_Keys>& Axis2DAxes : Axis2DToAxis1DMap)
+	if (IsValid(Mapping.Action))
 	{
-		if (Axis2DAxes.Value.PositiveKey == Key) return Axis2DAxes.Value.NegativeKey;
-		if (Axis2DAxes.Value.NegativeKey == Key) return Axis2DAxes.Value.PositiveKey;
+		ReadModifiers(Mapping.Action->Modifiers);
 	}
-	return FKey();
+
+	bIsHold = UUINavInputBox::HasHoldModifier(Mapping);
 }
 
-void UUINavPCComponent::GetAxisPropertiesFromMapping(const FEnhancedActionKeyMapping& ActionMapping, bool& bOutPositive, EInputAxis& OutAxis) const
+bool FInputMappingDescriptor::Matches(const FEnhancedActionKeyMapping& Mapping) const
 {
-	TArray<UInputModifier*> Modifiers(ActionMapping.Modifiers);
-	Modifiers.Append(ActionMapping.Action->Modifiers);
-	bOutPositive = true;
-	if (!IsAxis2D(ActionMapping.Key))
+	return Key == Mapping.Key &&
+		Action == Mapping.Action &&
+		NumModifiers == Mapping.Modifiers.Num() &&
+		NumTriggers == Mapping.Triggers.Num() &&
+		LastModifier == (NumModifiers > 0 ? Mapping.Modifiers.Last().Get() : nullptr) &&
+		FirstTrigger == (NumTriggers > 0 ? Mapping.Triggers[0].Get() : nullptr) &&
+		(!IsValid(MappingNegate) ||
+			(MappingNegate->bX == bMappingNegateX && MappingNegate->bY == bMappingNegateY && MappingNegate->bZ == bMappingNegateZ));
+}
+
+void FInputMappingDescriptor::GetAxisProperties(const bool bIsAxis2D, bool& bOutPositive, EInputAxis& OutAxis) const
+{
+	// 2D axis keys keep the requested axis
+	if (!bIsAxis2D)
 	{
-		OutAxis = EInputAxis::X;
+		OutAxis = SwizzleAxis;
 	}
 
-	for (const UInputModifier* Modifier : Modifiers)
+	bOutPositive = true;
+	if (bHasNegate)
 	{
-		const UInputModifierSwizzleAxis* Swizzle = Cast<UInputModifierSwizzleAxis>(Modifier);
-		if (Swizzle != nullptr && !IsAxis2D(ActionMapping.Key))
+		switch (OutAxis)
 		{
-			switch (Swizzle->Order)
-			{
-			case EInputAxisSwizzle::YXZ:
-			case EInputAxisSwizzle::YZX:
-				OutAxis = EInputAxis::Y;
-				break;
-			case EInputAxisSwizzle::ZXY:
-			case EInputAxisSwizzle::ZYX:
-				OutAxis = EInputAxis::Z;
-				break;
-			}
-			continue;
+		case EInputAxis::X:
+			bOutPositive = !bNegateX;
+			break;
+		case EInputAxis::Y:
+			bOutPositive = !bNegateY;
+			break;
+		case EInputAxis::Z:
+			bOutPositive = !bNegateZ;
+			break;
 		}
 	}
+}
 
-	for (const UInputModifier* Modifier : Modifiers)
+void UUINavPCComponent::GetAxisPropertiesFromMapping(const FEnhancedActionKeyMapping& ActionMapping, bool& bOutPositive, EInputAxis& OutAxis) const
+{
+	FInputMappingDescriptor(ActionMapping).GetAxisProperties(IsAxis2D(ActionMapping.Key), bOutPositive, OutAxis);
+}
+
+void UUINavPCComponent::GetAxisPropertiesFromMapping(const UInputMappingContext* InputContext, const int32 MappingIndex, bool& bOutPositive, EInputAxis& OutAxis) const
+{
+	const FInputMappingDescriptor& Descriptor = GetMappingDescriptor(InputContext, MappingIndex);
+	Descriptor.GetAxisProperties(IsAxis2D(Descriptor.Key), bOutPositive, OutAxis);
+}
+
+const FInputMappingDescriptor& UUINavPCComponent::GetMappingDescriptor(const UInputMappingContext* InputContext, const int32 MappingIndex) const
+{
+	const TArray<FEnhancedActionKeyMapping>& Mappings = InputContext->GetMappings();
+	check(Mappings.IsValidIndex(MappingIndex));
+
+	TArray<FInputMappingDescriptor>& Descriptors = MappingDescriptors.FindOrAdd(InputContext);
+	if (Descriptors.Num() != Mappings.Num())
 	{
-		const UInputModifierNegate* Negate = Cast<UInputModifierNegate>(Modifier);
-		if (Negate != nullptr)
+		Descriptors.Reset(Mappings.Num());
+		for (const FEnhancedActionKeyMapping& Mapping : Mappings)
 		{
-			if (OutAxis == EInputAxis::X)
-			{
-				bOutPositive = !Negate->bX;
-			}
-			else if (OutAxis == EInputAxis::Y)
-			{
-				bOutPositive = !Negate->bY;
-			}
-			else if (OutAxis == EInputAxis::Z)
-			{
-				bOutPositive = !Negate->bZ;
-			}
-			continue;
+			Descriptors.Emplace(Mapping);
 		}
+	}
+	else if (!Descriptors[MappingIndex].Matches(Mappings[MappingIndex]))
+	{
+		Descriptors[MappingIndex] = FInputMappingDescriptor(Mappings[MappingIndex]);
+	}
+
+	return Descriptors[MappingIndex];
+}
 
-		// TODO: Add support for Scalar input modifier
+void UUINavPCComponent::InvalidateMappingDescriptors(const UInputMappingContext* InputContext /*= nullptr*/)
+{
+	if (InputContext == nullptr)
+	{
+		MappingDescriptors.Reset();
+	}
+	else
+	{
+		MappingDescriptors.Remove(InputContext);
 	}
 }
 
 bool UUINavPCComponent::IsAxis2D(const FKey& Key) const
 {
-	return Axis2DToAxis1DMap.Contains(Key);
+	return GetAxisKeyRelations().Axis2DToAxis1DMap.Contains(Key);
 }
 
 bool UUINavPCComponent::IsAxis(const FKey& Key) const
 {
-	return IsAxis2D(Key) || AxisToKeyMap.Contains(Key);
+	return IsAxis2D(Key) || GetAxisKeyRelations().AxisToKeyMap.Contains(Key);
 }
 
 void UUINavPCComponent::VerifyInputTypeChangeByKey(const FKeyEvent& KeyEvent, const bool bAttemptUnforceNavigation /*= true*/)
@@ -2190,10 +2799,270 @@ bool UUINavPCComponent::TryNavigateInDirection(const EUINavigation Direction, co
 	}
 
 	bAutomaticNavigation = false;
+
+	// A navigation without an input stamp, such as a chained one, replaces any unfinished one without being timed
+	NavigationLatencyStartTime = PendingNavigationInputTime;
+	NavigationLatencyStartFrame = PendingNavigationInputFrame;
+	ClearNavigationInputStamp();
+
 	IUINavPCReceiver::Execute_OnNavigated(GetOwner(), Direction);
 	return true;
 }
 
+void UUINavPCComponent::StampNavigationInput(const bool bOverwrite)
+{
+	// Analog events keep arriving while a stick is held, and the navigations they chain aren't new inputs
+	if (!bOverwrite && CallbackDirection != EUINavigation::Invalid)
+	{
+		return;
+	}
+
+	if (!bOverwrite && PendingNavigationInputTime > 0.0)
+	{
+		return;
+	}
+
+	// A new input means that the navigation in progress, if any, didn't finish
+	NavigationLatencyStartTime = 0.0;
+	NavigationLatencyStartFrame = 0;
+
+	PendingNavigationInputTime = FPlatformTime::Seconds();
+	PendingNavigationInputFrame = GFrameCounter;
+}
+
+void UUINavPCComponent::ClearNavigationInputStamp()
+{
+	PendingNavigationInputTime = 0.0;
+	PendingNavigationInputFrame = 0;
+}
+
+void UUINavPCComponent::RecordNavigationLatency()
+{
+	if (NavigationLatencyStartTime <= 0.0)
+	{
+		return;
+	}
+
+	// Slow navigations are recorded too, the histogram's last bucket holds them
+	const double LatencySeconds = FPlatformTime::Seconds() - NavigationLatencyStartTime;
+	NavigationLatency.AddSample(LatencySeconds * 1000.0, GFrameCounter - NavigationLatencyStartFrame);
+	NavigationLatencyStartTime = 0.0;
+	NavigationLatencyStartFrame = 0;
+}
+
+void UUINavPCComponent::AbandonNavigationLatency()
+{
+	ClearNavigationInputStamp();
+	NavigationLatencyStartTime = 0.0;
+	NavigationLatencyStartFrame = 0;
+}
+
+void UUINavPCComponent::ResetNavigationLatency()
+{
+	NavigationLatency.Reset();
+}
+
+void UUINavPCComponent::NotifyParentRetained(UUINavWidget* Widget, UUINavWidget* ChildWidget /*= nullptr*/)
+{
+	if (!IsValid(Widget))
+	{
+		return;
+	}
+
+	FRetainedParent& RetainedParent = RetainedParents.AddDefaulted_GetRef();
+	RetainedParent.Widget = Widget;
+	RetainedParent.ChildWidget = ChildWidget;
+	RetainedParent.Policy = Widget->ParentRetentionPolicy;
+	RetainedParent.EstimatedBytes = EstimateWidgetMemory(Widget);
+
+	FParentRetentionStats& Stats = ParentRetentionStats.FindOrAdd(RetainedParent.Policy);
+	++Stats.NumRetained;
+	Stats.RetainedMemoryKB += RetainedParent.EstimatedBytes / 1024.0f;
+
+	if (RetainedParent.Policy == EParentRetentionPolicy::EvictUnderBudget)
+	{
+		EvictRetainedParentsOverBudget();
+	}
+}
+
+void UUINavPCComponent::NotifyParentRestored(UUINavWidget* Widget, const double ReturnMs)
+{
+	if (!IsValid(Widget))
+	{
+		return;
+	}
+
+	const int32 RetainedIndex = RetainedParents.IndexOfByPredicate([Widget](const FRetainedParent& RetainedParent) { return RetainedParent.Widget.Get() == Widget; });
+	if (RetainedIndex != INDEX_NONE)
+	{
+		RemoveRetainedParentAt(RetainedIndex);
+	}
+
+	// Widgets recreated after an eviction aren't retained anymore, but their return cost still counts
+	ParentRetentionStats.FindOrAdd(Widget->ParentRetentionPolicy).RecordReturn(ReturnMs);
+}
+
+void UUINavPCComponent::NotifyParentDiscarded(UUINavWidget* Widget)
+{
+	const int32 RetainedIndex = RetainedParents.IndexOfByPredicate([Widget](const FRetainedParent& RetainedParent) { return RetainedParent.Widget.Get() == Widget; });
+	if (RetainedIndex != INDEX_NONE)
+	{
+		RemoveRetainedParentAt(RetainedIndex);
+	}
+}
+
+void UUINavPCComponent::RemoveRetainedParentAt(const int32 Index)
+{
+	const FRetainedParent& RetainedParent = RetainedParents[Index];
+	FParentRetentionStats& Stats = ParentRetentionStats.FindOrAdd(RetainedParent.Policy);
+	--Stats.NumRetained;
+	Stats.RetainedMemoryKB -= RetainedParent.EstimatedBytes / 1024.0f;
+	RetainedParents.RemoveAt(Index);
+}
+
+FParentRetentionStats UUINavPCComponent::GetParentRetentionStats(const EParentRetentionPolicy Policy) const
+{
+	const FParentRetentionStats* const Stats = ParentRetentionStats.Find(Policy);
+	return Stats != nullptr ? *Stats : FParentRetentionStats();
+}
+
+void UUINavPCComponent::EvictRetainedParentsOverBudget()
+{
+	const int64 BudgetBytes = static_cast<int64>(GetDefault<UUINavSettings>()->RetainedParentsMemoryBudgetKB) * 1024;
+
+	// Drop the entries of widgets that were destroyed without being restored, so that they don't count towards the budget
+	for (int32 i = RetainedParents.Num() - 1; i >= 0; --i)
+	{
+		if (!RetainedParents[i].Widget.IsValid() || RetainedParents[i].ChildWidget.IsStale())
+		{
+			RemoveRetainedParentAt(i);
+		}
+	}
+
+	int64 EvictableBytes = 0;
+	for (const FRetainedParent& RetainedParent : RetainedParents)
+	{
+		if (RetainedParent.Policy == EParentRetentionPolicy::EvictUnderBudget)
+		{
+			EvictableBytes += RetainedParent.EstimatedBytes;
+		}
+	}
+
+	for (int32 i = 0; i < RetainedParents.Num() && EvictableBytes > BudgetBytes;)
+	{
+		const FRetainedParent& RetainedParent = RetainedParents[i];
+		UUINavWidget* const ChildWidget = RetainedParent.ChildWidget.Get();
+		if (RetainedParent.Policy != EParentRetentionPolicy::EvictUnderBudget ||
+			!IsValid(ChildWidget) ||
+			ChildWidget->ParentWidget != RetainedParent.Widget.Get() ||
+			!ChildWidget->EvictParent())
+		{
+			++i;
+			continue;
+		}
+
+		++ParentRetentionStats.FindOrAdd(RetainedParent.Policy).NumEvictions;
+		EvictableBytes -= RetainedParent.EstimatedBytes;
+		RemoveRetainedParentAt(i);
+	}
+}
+
+int64 UUINavPCComponent::EstimateWidgetMemory(const UUINavWidget* Widget)
+{
+	int64 Bytes = Widget->GetClass()->GetStructureSize();
+	ForEachObjectWithOuter(Widget, [&Bytes](const UObject* Object)
+	{
+		Bytes += Object->GetClass()->GetStructureSize();
+	}, /*bIncludeNestedObjects*/ true);
+	return Bytes;
+}
+
+namespace UINavNavigationLatency
+{
+	/**
+	*	Logs the navigation latency histogram of every UINavPC.
+	*	Usage: UINav.NavigationLatency [Reset | BudgetMs [Percentile]]
+	*	When a budget is given, an error is logged for every UINavPC whose latency percentile (95 by default) exceeds it.
+	*/
+	static void Run(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!IsValid(World))
+		{
+			return;
+		}
+
+		const bool bReset = Args.Num() > 0 && Args[0].Equals(TEXT("Reset"), ESearchCase::IgnoreCase);
+		const float BudgetMs = !bReset && Args.Num() > 0 ? FCString::Atof(*Args[0]) : 0.0f;
+		const float Percentile = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 95.0f;
+
+		for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+		{
+			const APlayerController* const PlayerController = Iterator->Get();
+			UUINavPCComponent* const UINavPC = IsValid(PlayerController) ? PlayerController->FindComponentByClass<UUINavPCComponent>() : nullptr;
+			if (!IsValid(UINavPC))
+			{
+				continue;
+			}
+
+			if (bReset)
+			{
+				UINavPC->ResetNavigationLatency();
+				continue;
+			}
+
+			const FNavigationLatencyHistogram& Histogram = UINavPC->GetNavigationLatency();
+			UE_LOG(LogUINavigation, Display, TEXT("Navigation latency for %s:\n%s"), *PlayerController->GetName(), *Histogram.ToString());
+
+			if (BudgetMs > 0.0f && Histogram.GetPercentileMs(Percentile) > BudgetMs)
+			{
+				UE_LOG(LogUINavigation, Error, TEXT("Navigation latency budget exceeded for %s: P%.0f is %.2fms, budget is %.2fms"),
+					*PlayerController->GetName(), Percentile, Histogram.GetPercentileMs(Percentile), BudgetMs);
+			}
+		}
+	}
+
+	/**
+	*	Logs the memory and return latency cost of each parent retention policy for every UINavPC
+	*/
+	static void LogRetentionStats(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!IsValid(World))
+		{
+			return;
+		}
+
+		const UEnum* const PolicyEnum = StaticEnum<EParentRetentionPolicy>();
+		for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+		{
+			const APlayerController* const PlayerController = Iterator->Get();
+			const UUINavPCComponent* const UINavPC = IsValid(PlayerController) ? PlayerController->FindComponentByClass<UUINavPCComponent>() : nullptr;
+			if (!IsValid(UINavPC))
+			{
+				continue;
+			}
+
+			for (int32 i = 0; i < PolicyEnum->NumEnums() - 1; ++i)
+			{
+				const EParentRetentionPolicy Policy = static_cast<EParentRetentionPolicy>(PolicyEnum->GetValueByIndex(i));
+				const FParentRetentionStats Stats = UINavPC->GetParentRetentionStats(Policy);
+				UE_LOG(LogUINavigation, Display, TEXT("%s %s: %d retained (%.1fKB), %d evictions, %d returns (average %.2fms, max %.2fms)"),
+					*PlayerController->GetName(), *PolicyEnum->GetNameStringByIndex(i),
+					Stats.NumRetained, Stats.RetainedMemoryKB, Stats.NumEvictions, Stats.NumReturns, Stats.AverageReturnMs, Stats.MaxReturnMs);
+			}
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs RetentionStatsCommand(
+		TEXT("UINav.RetentionStats"),
+		TEXT("Logs the memory and return latency cost of each parent retention policy"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&LogRetentionStats));
+
+	static FAutoConsoleCommandWithWorldAndArgs NavigationLatencyCommand(
+		TEXT("UINav.NavigationLatency"),
+		TEXT("Logs the input-to-visual navigation latency of every UINavPC. Usage: UINav.NavigationLatency [Reset | BudgetMs [Percentile]]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Run));
+}
+
 void UUINavPCComponent::ClearAnalogKeysFromPressedKeys(const FKey& PressedKey)
 {
 	auto IsLeftAnalogKey = [](const FKey& Key) -> bool
@@ -2,6 +2,7 @@
 
 #include "UINavPromptWidget.h"
 #include "UINavBlueprintFunctionLibrary.h"
+#include "UINavPCComponent.h"
 #include "Components/TextBlock.h"
 #include "Components/RichTextBlock.h"
 #include "Data/PromptData.h"
@@ -41,12 +42,12 @@ void UUINavPromptWidget::NativeConstruct()
 
 void UUINavPromptWidget::OnSelect_Implementation(UUINavComponent* Component)
 {
-	ProcessPromptWidgetSelected(UUINavBlueprintFunctionLibrary::CreateBinaryPromptData(IsAcceptComponent(Component)));
+	ProcessPromptWidgetSelected(GetBinaryPromptData(IsAcceptComponent(Component)));
 }
 
 void UUINavPromptWidget::OnReturn_Implementation()
 {
-	ProcessPromptWidgetSelected(UUINavBlueprintFunctionLibrary::CreateBinaryPromptData(false));
+	ProcessPromptWidgetSelected(GetBinaryPromptData(false));
 }
 
 void UUINavPromptWidget::ProcessPromptWidgetSelected_Implementation(UPromptDataBase* InPromptData)
@@ -56,9 +57,16 @@ void UUINavPromptWidget::ProcessPromptWidgetSelected_Implementation(UPromptDataB
 		return;
 	}
 
+	UUINavPCComponent* const PromptUINavPC = UINavPC;
+
 	ReturnToParent();
 
 	ExecuteCallback(InPromptData);
+
+	if (IsValid(PromptUINavPC))
+	{
+		PromptUINavPC->ReleasePromptWidget(this);
+	}
 }
 
 bool UUINavPromptWidget::IsAcceptComponent(UUINavComponent* Component) const
@@ -70,3 +78,49 @@ void UUINavPromptWidget::ExecuteCallback(UPromptDataBase* InPromptData)
 {
 	Callback.ExecuteIfBound(InPromptData);
 }
+
+void UUINavPromptWidget::PrewarmPromptData()
+{
+	GetBinaryPromptData(false);
+}
+
+void UUINavPromptWidget::ResetPromptState()
+{
+	Title = FText();
+	Message = FText();
+	Callback.Unbind();
+
+	ParentWidget = nullptr;
+	ReturnedFromWidget = nullptr;
+	bParentRemoved = false;
+	bShouldDestroyParent = false;
+	bHiddenByChild = false;
+	EvictedParent = FEvictedUINavWidget();
+	NavigationSnapshot = FNavigationSnapshot();
+
+	// The next prompt starts without navigation state, like a newly created widget
+	CurrentComponent = nullptr;
+	HoveredComponent = nullptr;
+	SelectedComponent = nullptr;
+	SelectCount = 0;
+	CurrentListView.Reset();
+	CurrentListItem.Reset();
+	CurrentListItemIndex = INDEX_NONE;
+	bCompletedSetup = false;
+	CleanSetup();
+
+	// The last decision's prompt data may still be held by its callback, so the next prompt gets a new one
+	BinaryPromptData = nullptr;
+	PrewarmPromptData();
+}
+
+UPromptDataBinary* UUINavPromptWidget::GetBinaryPromptData(const bool bAccept)
+{
+	if (!IsValid(BinaryPromptData))
+	{
+		BinaryPromptData = NewObject<UPromptDataBinary>(this);
+	}
+
+	BinaryPromptData->bAccept = bAccept;
+	return BinaryPromptData;
+}
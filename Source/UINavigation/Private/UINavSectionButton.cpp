@@ -2,4 +2,25 @@
 
 
 #include "UINavSectionButton.h"
+#include "UINavWidget.h"
+#include "Components/Button.h"
 
+void UUINavSectionButtonBinding::Bind(UButton* InButton, UUINavWidget* InWidget, const int32 InSectionIndex)
+{
+	Button = InButton;
+	Widget = InWidget;
+	SectionIndex = InSectionIndex;
+
+	if (IsValid(Button))
+	{
+		Button->OnClicked.AddUniqueDynamic(this, &UUINavSectionButtonBinding::OnSectionButtonClicked);
+	}
+}
+
+void UUINavSectionButtonBinding::OnSectionButtonClicked()
+{
+	if (IsValid(Widget))
+	{
+		Widget->OnSectionButtonPressed(SectionIndex);
+	}
+}
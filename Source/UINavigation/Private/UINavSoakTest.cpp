@@ -0,0 +1,378 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "UINavigation.h"
+#include "UINavPCComponent.h"
+#include "UINavWidget.h"
+#include "UINavPromptWidget.h"
+#include "UINavInputBox.h"
+#include "UINavInputContainer.h"
+#include "UINavBlueprintFunctionLibrary.h"
+#include "Blueprint/WidgetBlueprintLibrary.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Math/RandomStream.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace UINavSoakTest
+{
+	static int32 MaxObjectGrowth = 1000;
+	static FAutoConsoleVariableRef CVarMaxObjectGrowth(
+		TEXT("UINav.Soak.MaxObjectGrowth"),
+		MaxObjectGrowth,
+		TEXT("Maximum number of UObjects the soak test may leave alive in any sample compared to its first sample"));
+
+	static int32 MaxWidgetGrowth = 0;
+	static FAutoConsoleVariableRef CVarMaxWidgetGrowth(
+		TEXT("UINav.Soak.MaxWidgetGrowth"),
+		MaxWidgetGrowth,
+		TEXT("Maximum number of UINavWidgets the soak test may leave alive in any sample compared to its first sample, not counting pooled prompt widgets"));
+
+	static float MaxMemoryGrowthMB = 64.0f;
+	static FAutoConsoleVariableRef CVarMaxMemoryGrowthMB(
+		TEXT("UINav.Soak.MaxMemoryGrowthMB"),
+		MaxMemoryGrowthMB,
+		TEXT("Maximum growth, in MB, of the used physical memory in any sample compared to the soak test's first sample"));
+
+	static int32 StepsPerSample = 500;
+	static FAutoConsoleVariableRef CVarStepsPerSample(
+		TEXT("UINav.Soak.StepsPerSample"),
+		StepsPerSample,
+		TEXT("Number of soak test steps between samples, each taken after returning to the root widget and collecting garbage"));
+
+	static int32 Seed = 0;
+	static FAutoConsoleVariableRef CVarSeed(
+		TEXT("UINav.Soak.Seed"),
+		Seed,
+		TEXT("Seed of the soak test's random walk"));
+
+	static constexpr int32 MaxDepth = 8;
+
+	// The walk never goes deeper than MaxDepth, so returning to the root takes at most that many steps, with some slack
+	// for widgets that take a frame to be removed
+	static constexpr int32 MaxReturnSteps = MaxDepth * 2;
+
+	struct FSample
+	{
+		int32 NumObjects = 0;
+		int32 NumWidgets = 0;
+		uint64 UsedMemory = 0;
+	};
+
+	/**
+	*	Runs a random walk through GoToWidget, ReturnToParent, prompts, rebinds and navigation, one step per frame,
+	*	and samples UObject, widget and memory counts every StepsPerSample steps.
+	*	Samples are taken at the root widget after a garbage collection, and the walk stops at the first one that grows past a threshold.
+	*/
+	class FSoakTest
+	{
+	public:
+
+		bool Start(UUINavPCComponent* InUINavPC, const int32 InNumSteps, const TArray<UClass*>& InWidgetClasses, UClass* InPromptClass)
+		{
+			if (TickerHandle.IsValid() || !IsValid(InUINavPC) || !IsValid(InUINavPC->GetActiveWidget()))
+			{
+				return false;
+			}
+
+			UINavPC = InUINavPC;
+			RootWidget = InUINavPC->GetActiveWidget();
+			NumSteps = InNumSteps;
+			Step = 0;
+			ReturnStep = 0;
+			bReturningToRoot = false;
+			// Read once, so that changing the console variable during the walk doesn't affect it
+			SamplePeriod = FMath::Max(1, StepsPerSample);
+			WidgetClasses.Reset();
+			for (UClass* const WidgetClass : InWidgetClasses)
+			{
+				WidgetClasses.Emplace(WidgetClass);
+			}
+			PromptClass.Reset(InPromptClass);
+			Stream.Initialize(Seed);
+			Samples.Reset();
+
+			Samples.Add(TakeSample(InUINavPC));
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSoakTest::Tick));
+			return true;
+		}
+
+		void Stop()
+		{
+			if (TickerHandle.IsValid())
+			{
+				FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+				Cleanup();
+			}
+		}
+
+	private:
+
+		TWeakObjectPtr<UUINavPCComponent> UINavPC;
+		TWeakObjectPtr<UUINavWidget> RootWidget;
+		// Kept alive so the classes aren't unloaded by the soak test's garbage collections
+		TArray<TStrongObjectPtr<UClass>> WidgetClasses;
+		TStrongObjectPtr<UClass> PromptClass;
+		FRandomStream Stream;
+		int32 NumSteps = 0;
+		int32 Step = 0;
+		int32 ReturnStep = 0;
+		int32 SamplePeriod = 1;
+		bool bReturningToRoot = false;
+		TArray<FSample> Samples;
+		FTSTicker::FDelegateHandle TickerHandle;
+
+		void Cleanup()
+		{
+			TickerHandle.Reset();
+			WidgetClasses.Reset();
+			PromptClass.Reset();
+		}
+
+		static FSample TakeSample(const UUINavPCComponent* PC)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, /*bPerformFullPurge*/ true);
+
+			FSample Sample;
+			Sample.NumObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+			Sample.UsedMemory = FPlatformMemory::GetStats().UsedPhysical;
+			TSet<UClass*> PromptClasses;
+			for (TObjectIterator<UUINavWidget> It; It; ++It)
+			{
+				if (!It->IsTemplate())
+				{
+					++Sample.NumWidgets;
+					if (It->IsA<UUINavPromptWidget>())
+					{
+						PromptClasses.Add(It->GetClass());
+					}
+				}
+			}
+
+			// Pooled prompt widgets are kept alive on purpose, up to MaxPooledPromptWidgets per class
+			for (UClass* const PromptClass : PromptClasses)
+			{
+				Sample.NumWidgets -= PC->GetNumPooledPromptWidgets(PromptClass);
+			}
+			return Sample;
+		}
+
+		bool ExceedsThresholds(const FSample& Sample, int32& OutObjectGrowth, int32& OutWidgetGrowth, double& OutMemoryGrowthMB) const
+		{
+			const FSample& First = Samples[0];
+			OutObjectGrowth = Sample.NumObjects - First.NumObjects;
+			OutWidgetGrowth = Sample.NumWidgets - First.NumWidgets;
+			OutMemoryGrowthMB = (static_cast<double>(Sample.UsedMemory) - static_cast<double>(First.UsedMemory)) / (1024.0 * 1024.0);
+			return OutObjectGrowth > MaxObjectGrowth || OutWidgetGrowth > MaxWidgetGrowth || OutMemoryGrowthMB > MaxMemoryGrowthMB;
+		}
+
+		int32 GetDepth(const UUINavWidget* Widget) const
+		{
+			int32 Depth = 0;
+			while (IsValid(Widget) && Widget != RootWidget.Get())
+			{
+				Widget = Widget->ParentWidget;
+				++Depth;
+			}
+			return Depth;
+		}
+
+		bool Tick(float DeltaTime)
+		{
+			UUINavPCComponent* const PC = UINavPC.Get();
+			if (!IsValid(PC) || !RootWidget.IsValid())
+			{
+				UE_LOG(LogUINavigation, Error, TEXT("UINav.Soak: The UINavPC or root widget was destroyed at step %d"), Step);
+				Cleanup();
+				return false;
+			}
+
+			if (!bReturningToRoot)
+			{
+				RunStep(PC);
+				++Step;
+				bReturningToRoot = Step % SamplePeriod == 0 || Step >= NumSteps;
+				return true;
+			}
+
+			// Return to the root widget before each sample, so only leaked objects are left
+			UUINavWidget* const ActiveWidget = PC->GetActiveWidget();
+			if (IsValid(ActiveWidget) && ActiveWidget != RootWidget.Get())
+			{
+				if (ReturnStep++ >= MaxReturnSteps)
+				{
+					UE_LOG(LogUINavigation, Error, TEXT("UINav.Soak failed after %d steps: Couldn't return to the root widget within %d steps, %s is still active"),
+						Step, MaxReturnSteps, *ActiveWidget->GetName());
+					Cleanup();
+					return false;
+				}
+
+				ActiveWidget->ReturnToParent();
+				return true;
+			}
+
+			bReturningToRoot = false;
+			ReturnStep = 0;
+			Samples.Add(TakeSample(PC));
+
+			int32 ObjectGrowth = 0;
+			int32 WidgetGrowth = 0;
+			double MemoryGrowthMB = 0.0;
+			if (Step < NumSteps && !ExceedsThresholds(Samples.Last(), ObjectGrowth, WidgetGrowth, MemoryGrowthMB))
+			{
+				return true;
+			}
+
+			Finish();
+			Cleanup();
+			return false;
+		}
+
+		void RunStep(UUINavPCComponent* PC)
+		{
+			UUINavWidget* const ActiveWidget = PC->GetActiveWidget();
+			if (!IsValid(ActiveWidget))
+			{
+				return;
+			}
+
+			if (UUINavPromptWidget* const PromptWidget = Cast<UUINavPromptWidget>(ActiveWidget))
+			{
+				PromptWidget->ProcessPromptWidgetSelected(UUINavBlueprintFunctionLibrary::CreateBinaryPromptData(Stream.FRand() < 0.5f));
+				return;
+			}
+
+			const int32 Depth = GetDepth(ActiveWidget);
+			switch (Stream.RandRange(0, 4))
+			{
+				case 0:
+					if (WidgetClasses.Num() > 0 && Depth < MaxDepth)
+					{
+						PC->GoToWidget(WidgetClasses[Stream.RandRange(0, WidgetClasses.Num() - 1)].Get(), false);
+						break;
+					}
+					// Return instead when the walk can't go deeper
+					[[fallthrough]];
+				case 1:
+					if (Depth > 0)
+					{
+						ActiveWidget->ReturnToParent();
+					}
+					break;
+				case 2:
+					if (PromptClass.IsValid() && Depth < MaxDepth)
+					{
+						PC->GoToPromptWidget(PromptClass.Get(), FPromptWidgetDecided(), FText::FromString(TEXT("Soak")), FText::FromString(TEXT("Soak")));
+					}
+					break;
+				case 3:
+					RunRebind(PC);
+					break;
+				default:
+					PC->NavigateInDirection(Stream.FRand() < 0.5f ? EUINavigation::Down : EUINavigation::Up);
+					break;
+			}
+		}
+
+		void RunRebind(UUINavPCComponent* PC)
+		{
+			TArray<UUserWidget*> InputContainers;
+			UWidgetBlueprintLibrary::GetAllWidgetsOfClass(PC, InputContainers, UUINavInputContainer::StaticClass(), /*bTopLevel*/ false);
+			if (InputContainers.Num() == 0)
+			{
+				return;
+			}
+
+			UUINavInputContainer* const InputContainer = Cast<UUINavInputContainer>(InputContainers[Stream.RandRange(0, InputContainers.Num() - 1)]);
+			if (!IsValid(InputContainer) || InputContainer->InputBoxes.Num() == 0)
+			{
+				return;
+			}
+
+			UUINavInputBox* const InputBox = InputContainer->InputBoxes[Stream.RandRange(0, InputContainer->InputBoxes.Num() - 1)];
+			const FKey Key = IsValid(InputBox) ? InputBox->GetKey(0) : FKey();
+			if (!Key.IsValid())
+			{
+				return;
+			}
+
+			// Rebind to the same key and roll back, so the walk doesn't change the player's bindings
+			InputContainer->BeginRebindTransaction();
+			InputBox->UpdateInputKey(Key, InputBox->bIsHoldInput[0], 0, /*bSkipChecks*/ true);
+			InputContainer->RollbackRebindTransaction();
+		}
+
+		void Finish() const
+		{
+			for (int32 i = 0; i < Samples.Num(); ++i)
+			{
+				UE_LOG(LogUINavigation, Display, TEXT("UINav.Soak sample %d: %d UObjects, %d UINavWidgets, %.1fMB used"),
+					i, Samples[i].NumObjects, Samples[i].NumWidgets, Samples[i].UsedMemory / (1024.0 * 1024.0));
+			}
+
+			int32 ObjectGrowth = 0;
+			int32 WidgetGrowth = 0;
+			double MemoryGrowthMB = 0.0;
+			if (ExceedsThresholds(Samples.Last(), ObjectGrowth, WidgetGrowth, MemoryGrowthMB))
+			{
+				UE_LOG(LogUINavigation, Error, TEXT("UINav.Soak failed after %d steps, at sample %d: %d UObjects (max %d), %d UINavWidgets (max %d), %.1fMB (max %.1fMB) of growth"),
+					Step, Samples.Num() - 1, ObjectGrowth, MaxObjectGrowth, WidgetGrowth, MaxWidgetGrowth, MemoryGrowthMB, MaxMemoryGrowthMB);
+				return;
+			}
+
+			UE_LOG(LogUINavigation, Display, TEXT("UINav.Soak passed after %d steps: %d UObjects, %d UINavWidgets, %.1fMB of growth"),
+				Step, ObjectGrowth, WidgetGrowth, MemoryGrowthMB);
+		}
+	};
+
+	static FSoakTest SoakTest;
+
+	/**
+	*	Usage: UINav.Soak [Steps] [WidgetClassPath,WidgetClassPath,...] [PromptWidgetClassPath]
+	*	The walk starts from the current active widget, which is never removed.
+	*/
+	static void Run(const TArray<FString>& Args, UWorld* World)
+	{
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("Stop"), ESearchCase::IgnoreCase))
+		{
+			SoakTest.Stop();
+			return;
+		}
+
+		const int32 NumSteps = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+
+		TArray<UClass*> WidgetClasses;
+		if (Args.Num() > 1)
+		{
+			TArray<FString> WidgetClassPaths;
+			Args[1].ParseIntoArray(WidgetClassPaths, TEXT(","));
+			for (const FString& WidgetClassPath : WidgetClassPaths)
+			{
+				if (UClass* const WidgetClass = LoadClass<UUINavWidget>(nullptr, *WidgetClassPath))
+				{
+					WidgetClasses.Add(WidgetClass);
+				}
+				else
+				{
+					UE_LOG(LogUINavigation, Warning, TEXT("UINav.Soak: Couldn't load widget class %s"), *WidgetClassPath);
+				}
+			}
+		}
+
+		UClass* const PromptClass = Args.Num() > 2 ? LoadClass<UUINavPromptWidget>(nullptr, *Args[2]) : nullptr;
+
+		if (!SoakTest.Start(UUINavBlueprintFunctionLibrary::GetFirstUINavPC(World), NumSteps, WidgetClasses, PromptClass))
+		{
+			UE_LOG(LogUINavigation, Warning, TEXT("UINav.Soak: Needs a UINavPC with an active widget and no soak test running"));
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs SoakCommand(
+		TEXT("UINav.Soak"),
+		TEXT("Runs a random walk through menu transitions, prompts and rebinds, and fails if UObjects, widgets or memory grow past the UINav.Soak.* thresholds. Usage: UINav.Soak [Steps] [WidgetClassPaths] [PromptWidgetClassPath] | Stop"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&Run));
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "UINavStats.h"
+#include "UINavWidget.h"
+#include "UINavComponent.h"
+#include "UINavInputBox.h"
+
+DEFINE_STAT(STAT_UINavPCTick);
+DEFINE_STAT(STAT_UINavHandleAnalogInput);
+DEFINE_STAT(STAT_UINavRefreshNavigationKeys);
+DEFINE_STAT(STAT_UINavHandleFocusChanging);
+DEFINE_STAT(STAT_UINavNavigatedTo);
+DEFINE_STAT(STAT_UINavInitialSetup);
+DEFINE_STAT(STAT_UINavCreateInputBoxes);
+DEFINE_STAT(STAT_UINavRebindKey);
+
+DEFINE_STAT(STAT_UINavLiveWidgets);
+DEFINE_STAT(STAT_UINavLiveComponents);
+DEFINE_STAT(STAT_UINavLiveInputBoxes);
+
+UE_TRACE_CHANNEL_DEFINE(UINavChannel);
+
+UE_TRACE_EVENT_BEGIN(UINav, Navigation)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Widget)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, FromComponent)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ToComponent)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(UINav, Focus)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Widget)
+	UE_TRACE_EVENT_FIELD(bool, Focused)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(UINav, Rebind)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, InputName)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Key)
+	UE_TRACE_EVENT_FIELD(int32, KeyIndex)
+UE_TRACE_EVENT_END()
+
+namespace UINavTrace
+{
+	static FString GetTraceName(const UObject* Object)
+	{
+		return IsValid(Object) ? Object->GetName() : FString();
+	}
+
+	void TraceNavigation(const UUINavWidget* Widget, const UUINavComponent* FromComponent, const UUINavComponent* ToComponent)
+	{
+		if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(UINavChannel))
+		{
+			return;
+		}
+
+		const FString WidgetName = GetTraceName(Widget);
+		const FString FromName = GetTraceName(FromComponent);
+		const FString ToName = GetTraceName(ToComponent);
+		UE_TRACE_LOG(UINav, Navigation, UINavChannel)
+			<< Navigation.Cycle(FPlatformTime::Cycles64())
+			<< Navigation.Widget(*WidgetName, WidgetName.Len())
+			<< Navigation.FromComponent(*FromName, FromName.Len())
+			<< Navigation.ToComponent(*ToName, ToName.Len());
+	}
+
+	void TraceFocus(const UUINavWidget* Widget, const bool bFocused)
+	{
+		if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(UINavChannel))
+		{
+			return;
+		}
+
+		const FString WidgetName = GetTraceName(Widget);
+		UE_TRACE_LOG(UINav, Focus, UINavChannel)
+			<< Focus.Cycle(FPlatformTime::Cycles64())
+			<< Focus.Widget(*WidgetName, WidgetName.Len())
+			<< Focus.Focused(bFocused);
+	}
+
+	void TraceRebind(const UUINavInputBox* InputBox, const FKey& NewKey, const int32 KeyIndex)
+	{
+		if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(UINavChannel))
+		{
+			return;
+		}
+
+		const FString InputName = IsValid(InputBox) ? InputBox->InputName.ToString() : FString();
+		const FString KeyName = NewKey.ToString();
+		UE_TRACE_LOG(UINav, Rebind, UINavChannel)
+			<< Rebind.Cycle(FPlatformTime::Cycles64())
+			<< Rebind.InputName(*InputName, InputName.Len())
+			<< Rebind.Key(*KeyName, KeyName.Len())
+			<< Rebind.KeyIndex(KeyIndex);
+	}
+}
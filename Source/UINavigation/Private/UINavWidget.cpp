@@ -14,6 +14,8 @@
 #include "UINavMacros.h"
 #include "UINavSectionsWidget.h"
 #include "UINavSectionButton.h"
+#include "UINavStats.h"
+#include "UINavInputRecorder.h"
 #include "ComponentActions/UINavComponentAction.h"
 #include "Blueprint/UserWidget.h"
 #include "Blueprint/WidgetTree.h"
@@ -27,15 +29,19 @@
 #include "Components/ScrollBox.h"
 #include "Components/CanvasPanel.h"
 #include "Components/CanvasPanelSlot.h"
+#include "Components/Button.h"
 #include "Components/ActorComponent.h"
 #include "Components/ListView.h"
 #include "Components/WidgetSwitcher.h"
+#include "HAL/PlatformTime.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/ViewportSplitScreen.h"
 #include "Engine/Console.h"
 #include "Curves/CurveFloat.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/InputDelegateBinding.h"
+#include "Engine/AssetManager.h"
+#include "TimerManager.h"
 
 UUINavWidget::UUINavWidget(const FObjectInitializer& ObjectInitializer)
 	:Super(ObjectInitializer)
@@ -45,6 +51,26 @@ UUINavWidget::UUINavWidget(const FObjectInitializer& ObjectInitializer)
 	bAutomaticallyRegisterInputOnConstruction = true;
 }
 
+void UUINavWidget::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!IsTemplate())
+	{
+		INC_DWORD_STAT(STAT_UINavLiveWidgets);
+	}
+}
+
+void UUINavWidget::BeginDestroy()
+{
+	if (!IsTemplate())
+	{
+		DEC_DWORD_STAT(STAT_UINavLiveWidgets);
+	}
+
+	Super::BeginDestroy();
+}
+
 void UUINavWidget::NativeConstruct()
 {
 	bBeingRemoved = false;
@@ -88,13 +114,33 @@ void UUINavWidget::NativeConstruct()
 	if (ParentWidget != nullptr && ParentWidget->IsInViewport() && bParentRemoved)
 	{
 		UUINavWidget* OuterParentWidget = ParentWidget->GetMostOuterUINavWidget();
-		OuterParentWidget->bReturningToParent = true;
-		OuterParentWidget->RemoveFromParent();
-
-		if (bShouldDestroyParent)
+		if (!bShouldDestroyParent && OuterParentWidget->ParentRetentionPolicy == EParentRetentionPolicy::KeepHidden)
 		{
-			ParentWidget = OuterParentWidget->ParentWidget;
-			OuterParentWidget = nullptr;
+			if (!OuterParentWidget->bHiddenByChild)
+			{
+				OuterParentWidget->bHiddenByChild = true;
+				OuterParentWidget->VisibilityBeforeHidden = OuterParentWidget->GetVisibility();
+				OuterParentWidget->SetVisibility(ESlateVisibility::Collapsed);
+				if (IsValid(OuterParentWidget->UINavPC))
+				{
+					OuterParentWidget->UINavPC->NotifyParentRetained(OuterParentWidget);
+				}
+			}
+		}
+		else
+		{
+			OuterParentWidget->bReturningToParent = true;
+			OuterParentWidget->RemoveFromParent();
+
+			if (bShouldDestroyParent)
+			{
+				ParentWidget = OuterParentWidget->ParentWidget;
+				OuterParentWidget = nullptr;
+			}
+			else if (IsValid(OuterParentWidget->UINavPC))
+			{
+				OuterParentWidget->UINavPC->NotifyParentRetained(OuterParentWidget, this);
+			}
 		}
 	}
 
@@ -120,6 +166,9 @@ void UUINavWidget::NativeConstruct()
 
 void UUINavWidget::InitialSetup(const bool bRebuilding)
 {
+	SCOPE_CYCLE_COUNTER(STAT_UINavInitialSetup);
+	UINAV_TRACE_SCOPE(UUINavWidget::InitialSetup);
+
 	if (!bRebuilding)
 	{
 		if (UINavPC == nullptr)
@@ -155,6 +204,11 @@ void UUINavWidget::InitialSetup(const bool bRebuilding)
 
 void UUINavWidget::ReconfigureSetup()
 {
+	if (GetMostOuterUINavWidget()->TryRestoreNavigationSnapshot())
+	{
+		return;
+	}
+
 	bSetupStarted = true;
 
 	if (!IsSelectorValid())
@@ -173,6 +227,182 @@ void UUINavWidget::ReconfigureSetup()
 	}
 }
 
+void UUINavWidget::SaveNavigationSnapshot(UUINavWidget* NavigatedWidget)
+{
+	FNavigationSnapshot& Snapshot = NavigationSnapshot;
+	Snapshot.Widget = NavigatedWidget;
+	Snapshot.CurrentComponent = NavigatedWidget->CurrentComponent;
+	Snapshot.HoveredComponent = NavigatedWidget->HoveredComponent;
+	Snapshot.SelectedComponent = NavigatedWidget->SelectedComponent;
+	Snapshot.SectionIndex = IsValid(UINavSwitcher) ? UINavSwitcher->GetActiveWidgetIndex() : INDEX_NONE;
+	Snapshot.SelectorTranslation = IsValid(NavigatedWidget->TheSelector) ? NavigatedWidget->TheSelector->GetRenderTransform().Translation : FVector2D::ZeroVector;
+	Snapshot.WidgetTreeHash = GetWidgetTreeHash();
+}
+
+bool UUINavWidget::TryRestoreNavigationSnapshot()
+{
+	if (!NavigationSnapshot.IsSet())
+	{
+		return false;
+	}
+
+	const FNavigationSnapshot Snapshot = NavigationSnapshot;
+	NavigationSnapshot = FNavigationSnapshot();
+
+	UUINavWidget* const NavigatedWidget = Snapshot.Widget.Get();
+	if (!IsValid(UINavPC) || !IsValid(NavigatedWidget->UINavPC) || GetWidgetTreeHash() != Snapshot.WidgetTreeHash)
+	{
+		return false;
+	}
+
+	if (Snapshot.SectionIndex != INDEX_NONE && IsValid(UINavSwitcher) && UINavSwitcher->GetActiveWidgetIndex() != Snapshot.SectionIndex)
+	{
+		UINavSwitcher->SetActiveWidgetIndex(Snapshot.SectionIndex);
+	}
+
+	NavigatedWidget->RestoreNavigationState(Snapshot);
+	return true;
+}
+
+void UUINavWidget::RestoreNavigationState(const FNavigationSnapshot& Snapshot)
+{
+	bSetupStarted = true;
+	UINavSetupWaitForTick = -1;
+
+	if (WidgetComp == nullptr)
+	{
+		FSlateApplication::Get().ReleaseAllPointerCapture();
+	}
+
+	bForcingNavigation = GetDefault<UUINavSettings>()->bForceNavigation || UINavPC->GetCurrentInputType() == EInputType::Gamepad;
+
+	SetPressingReturn(IsNavigationKeyPressed(EUINavigationAction::Back));
+	if (bPressingReturn && !GetDefault<UUINavSettings>()->bReturnOnPress)
+	{
+		bIgnoreFirstReturn = true;
+	}
+
+	// Place the selector where it was, so focusing the same component doesn't wait for the new geometry
+	if (IsValid(TheSelector))
+	{
+		TheSelector->SetRenderTranslation(Snapshot.SelectorTranslation);
+	}
+
+	// Hover and selection only carry over if the cursor and press are still on the same component
+	UUINavComponent* const SnapshotHoveredComponent = Snapshot.HoveredComponent.Get();
+	if (IsValid(SnapshotHoveredComponent) && SnapshotHoveredComponent->IsHovered())
+	{
+		SetHoveredComponent(SnapshotHoveredComponent);
+	}
+
+	UUINavComponent* const SnapshotSelectedComponent = Snapshot.SelectedComponent.Get();
+	if (IsValid(SnapshotSelectedComponent) && IsValid(SnapshotSelectedComponent->NavButton) && SnapshotSelectedComponent->NavButton->IsPressed())
+	{
+		SetSelectedComponent(SnapshotSelectedComponent);
+	}
+
+	UUINavComponent* const SnapshotCurrentComponent = Snapshot.CurrentComponent.Get();
+	if (IsValid(SnapshotCurrentComponent))
+	{
+		CurrentComponent = SnapshotCurrentComponent;
+		if (!TryFocusOnCurrentListItem())
+		{
+			SetFocusOnComponent(SnapshotCurrentComponent);
+		}
+		if (!GetDefault<UUINavSettings>()->bForceNavigation && !IsValid(HoveredComponent))
+		{
+			UnforceNavigation(false);
+		}
+	}
+	else if (!TryFocusOnInitialComponent())
+	{
+		UINavPC->NotifyNavigatedTo(this);
+	}
+
+	bCompletedSetup = true;
+	ReturnedFromWidget = nullptr;
+	IgnoreHoverComponent = nullptr;
+
+	PropagateOnSetupCompleted();
+}
+
+uint32 UUINavWidget::GetWidgetTreeHash() const
+{
+	uint32 Hash = 0;
+	if (IsValid(WidgetTree))
+	{
+		WidgetTree->ForEachWidget([&Hash](const UWidget* Widget)
+		{
+			Hash = HashCombineFast(Hash, GetTypeHash(Widget));
+		});
+	}
+
+	for (const UUINavWidget* const ChildUINavWidget : ChildUINavWidgets)
+	{
+		if (IsValid(ChildUINavWidget))
+		{
+			Hash = HashCombineFast(Hash, ChildUINavWidget->GetWidgetTreeHash());
+		}
+	}
+
+	return Hash;
+}
+
+bool UUINavWidget::EvictParent()
+{
+	if (!IsValid(ParentWidget) ||
+		ParentWidget->IsInViewport() ||
+		IsValid(ParentWidget->OuterUINavWidget) ||
+		IsValid(ParentWidget->WidgetComp))
+	{
+		return false;
+	}
+
+	EvictedParent.WidgetClass = ParentWidget->GetClass();
+	EvictedParent.ParentWidget = ParentWidget->ParentWidget;
+	EvictedParent.bParentRemoved = ParentWidget->bParentRemoved;
+	EvictedParent.bShouldDestroyParent = ParentWidget->bShouldDestroyParent;
+	EvictedParent.CurrentComponentName = IsValid(ParentWidget->CurrentComponent) ? ParentWidget->CurrentComponent->GetFName() : NAME_None;
+	EvictedParent.SectionIndex = IsValid(ParentWidget->UINavSwitcher) ? ParentWidget->UINavSwitcher->GetActiveWidgetIndex() : INDEX_NONE;
+
+	ParentWidget->ParentWidget = nullptr;
+	ParentWidget->ReturnedFromWidget = nullptr;
+	ParentWidget = nullptr;
+	return true;
+}
+
+void UUINavWidget::RestoreEvictedParent()
+{
+	if (ParentWidget != nullptr || !EvictedParent.IsSet())
+	{
+		return;
+	}
+
+	UUINavWidget* NewParentWidget = CreateWidget<UUINavWidget>(GetOwningPlayer(), EvictedParent.WidgetClass);
+	if (!IsValid(NewParentWidget))
+	{
+		return;
+	}
+
+	NewParentWidget->ParentWidget = EvictedParent.ParentWidget;
+	NewParentWidget->bParentRemoved = EvictedParent.bParentRemoved;
+	NewParentWidget->bShouldDestroyParent = EvictedParent.bShouldDestroyParent;
+
+	// Components register themselves as the first component only if none is set, so this restores the previous focus
+	if (!EvictedParent.CurrentComponentName.IsNone())
+	{
+		NewParentWidget->FirstComponent = Cast<UUINavComponent>(NewParentWidget->WidgetTree->FindWidget(EvictedParent.CurrentComponentName));
+	}
+
+	if (EvictedParent.SectionIndex != INDEX_NONE && IsValid(NewParentWidget->UINavSwitcher))
+	{
+		NewParentWidget->UINavSwitcher->SetActiveWidgetIndex(EvictedParent.SectionIndex);
+	}
+
+	ParentWidget = NewParentWidget;
+	EvictedParent = FEvictedUINavWidget();
+}
+
 void UUINavWidget::CleanSetup()
 {
 	for (UUINavWidget* ChildUINavWidget : ChildUINavWidgets)
@@ -181,6 +411,7 @@ void UUINavWidget::CleanSetup()
 	}
 	
 	bSetupStarted = false;
+	PendingHoverFocusComponent = nullptr;
 }
 
 void UUINavWidget::ConfigureUINavPC()
@@ -284,41 +515,11 @@ void UUINavWidget::SetupSections()
 		}
 	}
 
-	for (int i = 0; i < SectionButtons.Num(); ++i)
-	{
-		switch (i)
-		{
-		case 0:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed1);
-			break;
-		case 1:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed2);
-			break;
-		case 2:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed3);
-			break;
-		case 3:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed4);
-			break;
-		case 4:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed5);
-			break;
-		case 5:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed6);
-			break;
-		case 6:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed7);
-			break;
-		case 7:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed8);
-			break;
-		case 8:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed9);
-			break;
-		case 9:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed10);
-			break;
-		}
+	for (int32 i = SectionButtonBindings.Num(); i < SectionButtons.Num(); ++i)
+	{
+		UUINavSectionButtonBinding* const SectionButtonBinding = NewObject<UUINavSectionButtonBinding>(this);
+		SectionButtonBinding->Bind(SectionButtons[i], this, i);
+		SectionButtonBindings.Add(SectionButtonBinding);
 	}
 
 	if (SectionWidgets.IsEmpty())
@@ -326,13 +527,14 @@ void UUINavWidget::SetupSections()
 		static const TArray<TSubclassOf<UWidget>> WidgetClassArray = { UUINavWidget::StaticClass(), UUINavComponent::StaticClass() };
 		for (UWidget* const ChildWidget : UINavSwitcher->GetAllChildren())
 		{
-			UWidget* TargetWidget = UUINavBlueprintFunctionLibrary::FindWidgetOfClassesInWidget(ChildWidget, WidgetClassArray);
-			if (IsValid(TargetWidget))
-			{
-				SectionWidgets.Add(TargetWidget);
-			}
+			// Keep an entry for every section so indices match the switcher's, even if that section has nothing to navigate yet
+			SectionWidgets.Add(UUINavBlueprintFunctionLibrary::FindWidgetOfClassesInWidget(ChildWidget, WidgetClassArray));
 		}
 	}
+
+	const int32 ActiveSectionIndex = UINavSwitcher->GetActiveWidgetIndex();
+	LoadSectionContent(ActiveSectionIndex);
+	PrefetchAdjacentSections(ActiveSectionIndex);
 }
 
 void UUINavWidget::SetupSelector()
@@ -381,7 +583,7 @@ void UUINavWidget::UINavSetup()
 
 	if (ReturnedFromWidget != nullptr && IsValid(CurrentComponent))
 	{
-		if (bShouldTakeFocus)
+		if (bShouldTakeFocus && !TryFocusOnCurrentListItem())
 		{
 			SetFocusOnComponent(CurrentComponent);
 		}
@@ -416,7 +618,7 @@ bool UUINavWidget::TryFocusOnInitialComponent()
 		return true;
 	}
 
-	return false;
+	return NavigateToListItem(FirstListView.Get(), 0);
 }
 
 void UUINavWidget::PropagateGainNavigation(UUINavWidget* PreviousActiveWidget, UUINavWidget* NewActiveWidget, const UUINavWidget* const CommonParent)
@@ -529,7 +731,11 @@ void UUINavWidget::LoseNavigation(UUINavWidget* NewActiveWidget)
 
 	bHasNavigation = false;
 
-	if (!bNewWidgetIsChild && bHaveSameOuter && bClearNavigationStateWhenChild) CurrentComponent = nullptr;
+	if (!bNewWidgetIsChild && bHaveSameOuter && bClearNavigationStateWhenChild)
+	{
+		CurrentComponent = nullptr;
+		UpdateCurrentListItem(nullptr);
+	}
 
 	OnLostNavigation(NewActiveWidget, bNewWidgetIsChild);
 }
@@ -543,6 +749,7 @@ void UUINavWidget::SetCurrentComponent(UUINavComponent* Component)
 	const bool bShouldUnforceNavigation = !IsValid(CurrentComponent) && !GetDefault<UUINavSettings>()->bForceNavigation && !IsValid(HoveredComponent) && UINavPC->GetCurrentInputType() != EInputType::Gamepad;
 
 	CurrentComponent = Component;
+	UpdateCurrentListItem(Component);
 
 	if (bShouldUnforceNavigation)
 	{
@@ -686,6 +893,17 @@ void UUINavWidget::NativeTick(const FGeometry & MyGeometry, float DeltaTime)
 		}
 	}
 
+	if (PendingHoverFocusComponent != nullptr)
+	{
+		UUINavComponent* const Component = PendingHoverFocusComponent;
+		PendingHoverFocusComponent = nullptr;
+
+		if (IsValid(Component) && Component == HoveredComponent && UINavPC != nullptr)
+		{
+			ApplyHoveredComponent(Component);
+		}
+	}
+
 	if (bUpdateMousePositionNextFrame && !CurrentComponent->NavButton->GetCachedGeometry().GetLocalSize().IsNearlyZero())
 	{
 		SetMousePositionToButton(CurrentComponent, GetDefault<UUINavSettings>()->MoveMouseToButtonPosition);
@@ -697,7 +915,7 @@ void UUINavWidget::RemoveFromParent()
 {
 	bBeingRemoved = true;
 	if (OuterUINavWidget == nullptr && !bReturningToParent && !bDestroying && !GetFName().IsNone() && IsValid(this) &&
-	    (ParentWidget != nullptr || (bAllowRemoveIfRoot && UINavPC != nullptr)))
+	    (ParentWidget != nullptr || EvictedParent.IsSet() || (bAllowRemoveIfRoot && UINavPC != nullptr)))
 	{
 		ReturnToParent();
 		return;
@@ -711,6 +929,8 @@ FReply UUINavWidget::NativeOnFocusReceived(const FGeometry& InGeometry, const FF
 {
 	FReply Reply = Super::NativeOnFocusReceived(InGeometry, InFocusEvent);
 
+	UINavTrace::TraceFocus(this, true);
+
 	if (OuterUINavWidget != nullptr)
 	{
 		if (IsValid(CurrentComponent))
@@ -739,6 +959,8 @@ FReply UUINavWidget::NativeOnFocusReceived(const FGeometry& InGeometry, const FF
 void UUINavWidget::NativeOnFocusLost(const FFocusEvent& InFocusEvent)
 {
 	Super::NativeOnFocusLost(InFocusEvent);
+
+	UINavTrace::TraceFocus(this, false);
 }
 
 void UUINavWidget::NativeOnFocusChanging(const FWeakWidgetPath& PreviousFocusPath, const FWidgetPath& NewWidgetPath, const FFocusEvent& InFocusEvent)
@@ -760,6 +982,9 @@ FNavigationReply UUINavWidget::NativeOnNavigation(const FGeometry& MyGeometry, c
 
 void UUINavWidget::HandleOnFocusChanging(UUINavWidget* Widget, UUINavComponent* Component, const FWeakWidgetPath& PreviousFocusPath, const FWidgetPath& NewWidgetPath, const FFocusEvent& InFocusEvent)
 {
+	SCOPE_CYCLE_COUNTER(STAT_UINavHandleFocusChanging);
+	UINAV_TRACE_SCOPE(UUINavWidget::HandleOnFocusChanging);
+
 	const UUINavSettings* const UINavSettings = GetDefault<UUINavSettings>();
 
 	if (!IsValid(Widget) ||
@@ -904,6 +1129,13 @@ void UUINavWidget::HandleOnNavigation(FNavigationReply& Reply, UUINavWidget* Wid
 			return;
 		}
 	}
+
+	// Chain page steps land further than the adjacent component, unless the navigation rules say otherwise
+	const UUINavComponent* const PageDestination = Widget->UINavPC->GetPageNavigationDestination();
+	if (IsValid(PageDestination) && PageDestination->GetCachedWidget().IsValid() && Reply.GetBoundaryRule() == EUINavigationRule::Escape)
+	{
+		Reply = FNavigationReply::Explicit(PageDestination->GetCachedWidget());
+	}
 }
 
 void UUINavWidget::HandleOnKeyDown(FReply& Reply, UUINavWidget* Widget, UUINavComponent* Component, const FKeyEvent& InKeyEvent)
@@ -1096,6 +1328,42 @@ void UUINavWidget::SetFocusOnComponent(UUINavComponent* Component)
 	}
 }
 
+void UUINavWidget::UpdateCurrentListItem(UUINavComponent* Component)
+{
+	UListView* const ListView = IsValid(Component) ? Component->GetOwningListView() : nullptr;
+	UObject* const ListItem = IsValid(ListView) ? ListView->ItemFromEntryWidget(*Component) : nullptr;
+	if (ListItem == nullptr)
+	{
+		CurrentListView = nullptr;
+		CurrentListItem = nullptr;
+		CurrentListItemIndex = INDEX_NONE;
+		return;
+	}
+
+	CurrentListView = ListView;
+	CurrentListItem = ListItem;
+	CurrentListItemIndex = ListView->GetIndexForItem(ListItem);
+}
+
+bool UUINavWidget::TryFocusOnCurrentListItem()
+{
+	UListView* const ListView = CurrentListView.Get();
+	if (!IsValid(ListView) || ListView->GetNumItems() == 0)
+	{
+		return false;
+	}
+
+	// Prefer the item itself in case the list was reordered, otherwise fall back to the position it was at
+	const UObject* const ListItem = CurrentListItem.Get();
+	int32 ItemIndex = ListItem != nullptr ? ListView->GetIndexForItem(ListItem) : INDEX_NONE;
+	if (ItemIndex == INDEX_NONE)
+	{
+		ItemIndex = FMath::Clamp(CurrentListItemIndex, 0, ListView->GetNumItems() - 1);
+	}
+
+	return NavigateToListItem(ListView, ItemIndex);
+}
+
 void UUINavWidget::GoToNextSection()
 {
 	if (!IsValid(UINavSwitcher))
@@ -1155,6 +1423,8 @@ void UUINavWidget::GoToSection(const int32 SectionIndex)
 		return;
 	}
 	
+	LoadSectionContent(SectionIndex);
+
 	const int32 OldIndex = UINavSwitcher->GetActiveWidgetIndex();
 	UINavSwitcher->SetActiveWidgetIndex(SectionIndex);
 	UWidget* TargetWidget = SectionWidgets[SectionIndex];
@@ -1162,57 +1432,131 @@ void UUINavWidget::GoToSection(const int32 SectionIndex)
 	{
 		TargetWidget->SetFocus();
 	}
+	PrefetchAdjacentSections(SectionIndex);
 	OnChangedSection(OldIndex, SectionIndex);
 }
 
-void UUINavWidget::OnSectionButtonPressed1()
+void UUINavWidget::OnSectionButtonPressed(const int32 SectionIndex)
 {
-	GoToSection(0);
+	GoToSection(SectionIndex);
 }
 
-void UUINavWidget::OnSectionButtonPressed2()
+void UUINavWidget::LoadSectionContent(const int32 SectionIndex)
 {
-	GoToSection(1);
-}
+	const TSoftClassPtr<UUserWidget>* const ContentClass = LazySectionContent.Find(SectionIndex);
+	if (ContentClass == nullptr || CreatedLazySections.Contains(SectionIndex))
+	{
+		return;
+	}
 
-void UUINavWidget::OnSectionButtonPressed3()
-{
-	GoToSection(2);
+	CreateLazySectionContent(SectionIndex, ContentClass->LoadSynchronous());
 }
 
-void UUINavWidget::OnSectionButtonPressed4()
+void UUINavWidget::PrefetchSectionContent(const int32 SectionIndex)
 {
-	GoToSection(3);
-}
+	const TSoftClassPtr<UUserWidget>* const ContentClass = LazySectionContent.Find(SectionIndex);
+	if (ContentClass == nullptr || CreatedLazySections.Contains(SectionIndex) || LazySectionLoadHandles.Contains(SectionIndex))
+	{
+		return;
+	}
 
-void UUINavWidget::OnSectionButtonPressed5()
-{
-	GoToSection(4);
-}
+	const TSoftClassPtr<UUserWidget> SoftContentClass = *ContentClass;
+	const UWorld* const World = GetWorld();
+	if (SoftContentClass.Get() != nullptr)
+	{
+		// Already in memory, so only spread the creation cost to the next frame
+		if (World != nullptr)
+		{
+			World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this, SectionIndex, SoftContentClass]()
+			{
+				CreateLazySectionContent(SectionIndex, SoftContentClass.Get());
+			}));
+		}
+		return;
+	}
 
-void UUINavWidget::OnSectionButtonPressed6()
-{
-	GoToSection(5);
-}
+	if (!UAssetManager::IsInitialized())
+	{
+		// The content will be loaded once the section is visited instead
+		return;
+	}
 
-void UUINavWidget::OnSectionButtonPressed7()
-{
-	GoToSection(6);
-}
+	TSharedPtr<FStreamableHandle> LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(SoftContentClass.ToSoftObjectPath(),
+		FStreamableDelegate::CreateWeakLambda(this, [this, SectionIndex, SoftContentClass]()
+		{
+			LazySectionLoadHandles.Remove(SectionIndex);
+			CreateLazySectionContent(SectionIndex, SoftContentClass.Get());
+		}));
 
-void UUINavWidget::OnSectionButtonPressed8()
-{
-	GoToSection(7);
+	if (LoadHandle.IsValid() && LoadHandle->IsLoadingInProgress())
+	{
+		LazySectionLoadHandles.Add(SectionIndex, LoadHandle);
+	}
 }
 
-void UUINavWidget::OnSectionButtonPressed9()
+void UUINavWidget::PrefetchAdjacentSections(const int32 SectionIndex)
 {
-	GoToSection(8);
+	if (!bPrefetchAdjacentSections || LazySectionContent.IsEmpty() || !IsValid(UINavSwitcher) || SectionIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 NumSections = UINavSwitcher->GetChildrenCount();
+	if (NumSections < 2)
+	{
+		return;
+	}
+
+	int32 NextIndex = SectionIndex + 1;
+	int32 PreviousIndex = SectionIndex - 1;
+	if (bWrapAutoSectionNavigation)
+	{
+		NextIndex %= NumSections;
+		PreviousIndex = (PreviousIndex + NumSections) % NumSections;
+	}
+
+	PrefetchSectionContent(NextIndex);
+	PrefetchSectionContent(PreviousIndex);
 }
 
-void UUINavWidget::OnSectionButtonPressed10()
+void UUINavWidget::CreateLazySectionContent(const int32 SectionIndex, UClass* const ContentClass)
 {
-	GoToSection(9);
+	if (ContentClass == nullptr || CreatedLazySections.Contains(SectionIndex) || !IsValid(UINavSwitcher))
+	{
+		return;
+	}
+
+	UPanelWidget* const SectionPanel = Cast<UPanelWidget>(UINavSwitcher->GetWidgetAtIndex(SectionIndex));
+	if (!IsValid(SectionPanel))
+	{
+		DISPLAYERROR("Lazy section content needs an empty PanelWidget in the UINavSwitcher at that section's index!");
+		return;
+	}
+
+	UUserWidget* const Content = CreateWidget<UUserWidget>(this, ContentClass);
+	if (Content == nullptr)
+	{
+		return;
+	}
+
+	CreatedLazySections.Add(SectionIndex);
+
+	// Register nested UINavWidgets before they're constructed, like TraverseHierarchy does for the ones in the designer
+	UUINavWidget* const ContentUINavWidget = Cast<UUINavWidget>(Content);
+	if (ContentUINavWidget != nullptr)
+	{
+		ContentUINavWidget->UINavWidgetPath = UINavWidgetPath;
+		ContentUINavWidget->UINavWidgetPath.Add(ChildUINavWidgets.Num());
+		ChildUINavWidgets.Add(ContentUINavWidget);
+	}
+
+	SectionPanel->AddChild(Content);
+
+	if (SectionWidgets.IsValidIndex(SectionIndex))
+	{
+		static const TArray<TSubclassOf<UWidget>> WidgetClassArray = { UUINavWidget::StaticClass(), UUINavComponent::StaticClass() };
+		SectionWidgets[SectionIndex] = UUINavBlueprintFunctionLibrary::FindWidgetOfClassesInWidget(Content, WidgetClassArray);
+	}
 }
 
 void UUINavWidget::UpdateSelectorLocation(UUINavComponent* Component)
@@ -1669,8 +2013,12 @@ UUINavWidget* UUINavWidget::GoToPromptWidget(TSubclassOf<UUINavPromptWidget> New
 		return nullptr;
 	}
 
-	APlayerController* PC = Cast<APlayerController>(UINavPC->GetOwner());
-	UUINavPromptWidget* NewWidget = CreateWidget<UUINavPromptWidget>(PC, NewWidgetClass);
+	UUINavPromptWidget* NewWidget = UINavPC->AcquirePromptWidget(NewWidgetClass);
+	if (NewWidget == nullptr)
+	{
+		return nullptr;
+	}
+
 	NewWidget->Title = Title;
 	NewWidget->Message = Message;
 	NewWidget->SetCallback(Event);
@@ -1704,6 +2052,8 @@ UUINavWidget * UUINavWidget::GoToBuiltWidget(UUINavWidget* NewWidget, const bool
 		}
 	}
 	
+	GetMostOuterUINavWidget()->SaveNavigationSnapshot(this);
+
 	NewWidget->ParentWidget = this;
 	NewWidget->bParentRemoved = bRemoveParent;
 	NewWidget->bShouldDestroyParent = bDestroyParent;
@@ -1742,6 +2092,12 @@ UUINavWidget * UUINavWidget::GoToBuiltWidget(UUINavWidget* NewWidget, const bool
 
 void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder)
 {
+	const double ReturnStartTime = FPlatformTime::Seconds();
+	if (!bRemoveAllParents)
+	{
+		RestoreEvictedParent();
+	}
+
  	if (ParentWidget == nullptr)
 	{
 		if (bAllowRemoveIfRoot && UINavPC != nullptr)
@@ -1803,9 +2159,18 @@ void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder
 				{
 					if (IsValid(ParentWidget))
 					{
+						UUINavWidget* const OuterParentWidget = ParentWidget->GetMostOuterUINavWidget();
 						ParentWidget->ReturnedFromWidget = this;
-						if (!bForceUsePlayerScreen && (!bUsingSplitScreen || ParentWidget->bUseFullscreenWhenSplitscreen)) ParentWidget->AddToViewport(ZOrder);
+						if (OuterParentWidget->bHiddenByChild)
+						{
+							OuterParentWidget->bHiddenByChild = false;
+							OuterParentWidget->SetVisibility(OuterParentWidget->VisibilityBeforeHidden);
+							ParentWidget->ReconfigureSetup();
+						}
+						else if (!bForceUsePlayerScreen && (!bUsingSplitScreen || ParentWidget->bUseFullscreenWhenSplitscreen)) ParentWidget->AddToViewport(ZOrder);
 						else ParentWidget->AddToPlayerScreen(ZOrder);
+
+						UINavPC->NotifyParentRestored(OuterParentWidget, (FPlatformTime::Seconds() - ReturnStartTime) * 1000.0);
 					}
 				}
 				else
@@ -1828,7 +2193,20 @@ void UUINavWidget::RemoveSelfAndAllParents()
 {
 	bHasNavigation = true;
 	LoseNavigation(nullptr);
-	if (ParentWidget != nullptr)
+	if (IsValid(UINavPC))
+	{
+		UINavPC->NotifyParentDiscarded(this);
+	}
+	if (ParentWidget == nullptr && EvictedParent.IsSet())
+	{
+		// The evicted parent isn't in the viewport, so only its own parents need removing
+		if (IsValid(EvictedParent.ParentWidget))
+		{
+			EvictedParent.ParentWidget->RemoveSelfAndAllParents();
+		}
+		EvictedParent = FEvictedUINavWidget();
+	}
+	else if (ParentWidget != nullptr)
 	{
 		ParentWidget->RemoveSelfAndAllParents();
 	}
@@ -1852,12 +2230,20 @@ int UUINavWidget::GetWidgetHierarchyDepth(UWidget* Widget) const
 
 void UUINavWidget::NavigatedTo(UUINavComponent* NavigatedToComponent, const bool bNotifyUINavPC /*= true*/)
 {
+	SCOPE_CYCLE_COUNTER(STAT_UINavNavigatedTo);
+	UINAV_TRACE_SCOPE(UUINavWidget::NavigatedTo);
+
+	// A recycled list entry is the same widget displaying another item, so it still counts as a new navigation
+	const bool bRecycledListEntry = CurrentListView.IsValid() && IsValid(NavigatedToComponent) && NavigatedToComponent->GetListItem() != CurrentListItem.Get();
 	if (!IsValid(UINavPC) ||
-		(CurrentComponent == NavigatedToComponent && UINavPC->GetActiveSubWidget() == this))
+		(CurrentComponent == NavigatedToComponent && UINavPC->GetActiveSubWidget() == this && !bRecycledListEntry))
 	{
 		return;
 	}
 
+	UINavTrace::TraceNavigation(this, CurrentComponent, NavigatedToComponent);
+	FUINavInputRecorder::Get().NotifyNavigatedTo(this, NavigatedToComponent);
+
 	const bool bHadNavigation = bHasNavigation;
 
 	if (bNotifyUINavPC)
@@ -1872,6 +2258,7 @@ void UUINavWidget::NavigatedTo(UUINavComponent* NavigatedToComponent, const bool
 		OnNavigate(CurrentComponent, NavigatedToComponent);
 
 		CurrentComponent = NavigatedToComponent;
+		UpdateCurrentListItem(NavigatedToComponent);
 
 		OuterUINavWidget->NavigatedTo(NavigatedToComponent, false);
 		return;
@@ -1906,6 +2293,8 @@ void UUINavWidget::NavigatedTo(UUINavComponent* NavigatedToComponent, const bool
 	{
 		bUpdateMousePositionNextFrame = true;
 	}
+
+	UINavPC->RecordNavigationLatency();
 }
 
 void UUINavWidget::CallOnNavigate(UUINavComponent* FromComponent, UUINavComponent* ToComponent)
@@ -2073,6 +2462,41 @@ void UUINavWidget::AddParentToPath(const int IndexInParent)
 	}
 }
 
+void UUINavWidget::SetFirstListView(UListView* ListView)
+{
+	if (FirstListView.IsValid())
+	{
+		return;
+	}
+
+	FirstListView = ListView;
+
+	if (IsValid(OuterUINavWidget))
+	{
+		OuterUINavWidget->SetFirstListView(ListView);
+	}
+}
+
+bool UUINavWidget::NavigateToListItem(UListView* ListView, const int32 ItemIndex)
+{
+	if (!IsValid(ListView) || ItemIndex < 0 || ItemIndex >= ListView->GetNumItems())
+	{
+		return false;
+	}
+
+	UUINavComponent* const EntryComponent = ListView->GetEntryWidgetFromItem<UUINavComponent>(ListView->GetItemAt(ItemIndex));
+	if (IsValid(EntryComponent))
+	{
+		ListView->ScrollIndexIntoView(ItemIndex);
+		SetFocusOnComponent(EntryComponent);
+		return true;
+	}
+
+	// The entry widget isn't generated, so the ListView focuses it once it's scrolled into view
+	ListView->NavigateToIndex(ItemIndex);
+	return true;
+}
+
 void UUINavWidget::SetFirstComponent(UUINavComponent* Component)
 {
 	if (IsValid(FirstComponent))
@@ -2124,10 +2548,6 @@ void UUINavWidget::OnHoveredComponent(UUINavComponent* Component)
 		return;
 	}
 
-	UINavPC->CancelRebind();
-
-	const bool bNavigatingToFirstComponent = CurrentComponent == nullptr;
-
 	SetHoveredComponent(Component);
 
 	if (Component == CurrentComponent && UINavPC->GetActiveSubWidget() == this)
@@ -2135,6 +2555,22 @@ void UUINavWidget::OnHoveredComponent(UUINavComponent* Component)
 		Component->RevertButtonStyle();
 	}
 
+	// Intermediate hovers only update the hover state and style, the last one of the frame is applied on the next tick
+	if (GetDefault<UUINavSettings>()->bCoalesceHoverFocus)
+	{
+		PendingHoverFocusComponent = Component;
+		return;
+	}
+
+	ApplyHoveredComponent(Component);
+}
+
+void UUINavWidget::ApplyHoveredComponent(UUINavComponent* Component)
+{
+	UINavPC->CancelRebind();
+
+	const bool bNavigatingToFirstComponent = CurrentComponent == nullptr;
+
 	if (!bForcingNavigation)
 	{
 		bForcingNavigation = true;
@@ -2170,6 +2606,11 @@ void UUINavWidget::OnUnhoveredComponent(UUINavComponent* Component)
 		SetHoveredComponent(nullptr);
 	}
 
+	if (PendingHoverFocusComponent == Component)
+	{
+		PendingHoverFocusComponent = nullptr;
+	}
+
 	if (Component == SelectedComponent)
 	{
 		SetSelectedComponent(nullptr);
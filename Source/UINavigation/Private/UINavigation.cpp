@@ -1,10 +1,14 @@
 // Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
 
 #include "UINavigation.h"
+#include "UINavInputProcessor.h"
+#include "Framework/Application/SlateApplication.h"
 #include "Modules/ModuleManager.h"
 
 #define LOCTEXT_NAMESPACE "FUINavigationModule"
 
+DEFINE_LOG_CATEGORY(LogUINavigation);
+
 void FUINavigationModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
@@ -14,6 +18,51 @@ void FUINavigationModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	if (InputProcessor.IsValid() && FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().UnregisterInputPreProcessor(InputProcessor);
+	}
+	InputProcessor.Reset();
+}
+
+FUINavigationModule& FUINavigationModule::Get()
+{
+	return FModuleManager::GetModuleChecked<FUINavigationModule>("UINavigation");
+}
+
+void FUINavigationModule::RegisterUINavPC(UUINavPCComponent* UINavPC, const int32 UserIndex)
+{
+	if (!FSlateApplication::IsInitialized())
+	{
+		return;
+	}
+
+	if (!InputProcessor.IsValid())
+	{
+		InputProcessor = MakeShareable(new FUINavInputProcessor());
+		FSlateApplication::Get().RegisterInputPreProcessor(InputProcessor);
+	}
+
+	InputProcessor->RegisterUINavPC(UINavPC, UserIndex);
+}
+
+void FUINavigationModule::UnregisterUINavPC(UUINavPCComponent* UINavPC)
+{
+	if (!InputProcessor.IsValid())
+	{
+		return;
+	}
+
+	InputProcessor->UnregisterUINavPC(UINavPC);
+
+	if (!InputProcessor->HasUINavPCs())
+	{
+		if (FSlateApplication::IsInitialized())
+		{
+			FSlateApplication::Get().UnregisterInputPreProcessor(InputProcessor);
+		}
+		InputProcessor.Reset();
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
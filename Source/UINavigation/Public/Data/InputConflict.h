@@ -0,0 +1,34 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "InputCoreTypes.h"
+#include "InputConflict.generated.h"
+
+class UInputAction;
+class UInputMappingContext;
+
+/**
+* Two mappings of different input actions that are bound to the same key
+*/
+USTRUCT(BlueprintType)
+struct FInputConflict
+{
+	GENERATED_BODY()
+
+	FInputConflict() {}
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Input")
+	FKey Key;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Input")
+	const UInputAction* Action = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Input")
+	const UInputMappingContext* InputContext = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Input")
+	const UInputAction* CollidingAction = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Input")
+	const UInputMappingContext* CollidingInputContext = nullptr;
+};
@@ -0,0 +1,44 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "Containers/Array.h"
+#include "Data/UINavEnhancedActionKeyMapping.h"
+#include "InputMappingOverride.generated.h"
+
+/**
+* An override of one of an input context's default mappings,
+* identified by its action and its index among that action's mappings
+*/
+USTRUCT(BlueprintType)
+struct FInputMappingOverride
+{
+	GENERATED_BODY()
+
+	FInputMappingOverride() {}
+
+	FInputMappingOverride(const int32 InSlot, const FUINavEnhancedActionKeyMapping& InMapping, const bool bInRemoved = false)
+	: Slot(InSlot), Mapping(InMapping), bRemoved(bInRemoved) {}
+
+	// The index of the overriden mapping among the mappings of the same action
+	UPROPERTY()
+	int32 Slot = 0;
+
+	// The mapping that replaces the default mapping in this slot, or that is added to it
+	UPROPERTY()
+	FUINavEnhancedActionKeyMapping Mapping;
+
+	// Whether the default mapping in this slot was removed
+	UPROPERTY()
+	bool bRemoved = false;
+};
+
+USTRUCT(BlueprintType)
+struct FInputMappingOverrideArray
+{
+	GENERATED_BODY()
+
+	FInputMappingOverrideArray() {}
+
+	UPROPERTY()
+	TArray<FInputMappingOverride> Overrides;
+};
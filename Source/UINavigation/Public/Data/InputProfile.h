@@ -0,0 +1,48 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "Containers/Map.h"
+#include "EnhancedActionKeyMapping.h"
+#include "Data/InputMappingOverride.h"
+#include "InputProfile.generated.h"
+
+class UInputMappingContext;
+
+/**
+* A named set of bindings, stored as the overrides of each input context's default mappings
+*/
+USTRUCT(BlueprintType)
+struct FInputProfile
+{
+	GENERATED_BODY()
+
+	FInputProfile() {}
+
+	UPROPERTY()
+	TMap<TSoftObjectPtr<UInputMappingContext>, FInputMappingOverrideArray> InputMappingOverrides;
+};
+
+USTRUCT()
+struct FResolvedInputMappings
+{
+	GENERATED_BODY()
+
+	FResolvedInputMappings() {}
+
+	UPROPERTY()
+	TArray<FEnhancedActionKeyMapping> Mappings;
+};
+
+/**
+* An input profile with its mappings already loaded and applied to its input contexts' default mappings
+*/
+USTRUCT()
+struct FResolvedInputProfile
+{
+	GENERATED_BODY()
+
+	FResolvedInputProfile() {}
+
+	UPROPERTY()
+	TMap<TObjectPtr<UInputMappingContext>, FResolvedInputMappings> InputContextMappings;
+};
@@ -0,0 +1,122 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "NavigationLatency.generated.h"
+
+/**
+* Histogram of the latency between a navigation input reaching the input processor and the navigated component being updated
+*/
+USTRUCT(BlueprintType)
+struct FNavigationLatencyHistogram
+{
+	GENERATED_BODY()
+
+	FNavigationLatencyHistogram()
+	{
+		Reset();
+	}
+
+	// Upper bound, in milliseconds, of each wall-clock bucket. Samples above the last bound go to the last bucket of BucketCounts
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Latency")
+	TArray<float> BucketUpperBoundsMs = { 1.0f, 2.0f, 4.0f, 8.0f, 16.7f, 33.3f, 50.0f, 100.0f, 250.0f };
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Latency")
+	TArray<int32> BucketCounts;
+
+	// Number of samples per frame latency. The last entry counts every sample of MaxFrameLatency frames or more
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Latency")
+	TArray<int32> FrameCounts;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Latency")
+	int32 NumSamples = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Latency")
+	float AverageMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Latency")
+	float MaxMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Latency")
+	int32 MaxFrames = 0;
+
+	static constexpr int32 MaxFrameLatency = 8;
+
+	void Reset()
+	{
+		BucketCounts.Init(0, BucketUpperBoundsMs.Num() + 1);
+		FrameCounts.Init(0, MaxFrameLatency + 1);
+		NumSamples = 0;
+		AverageMs = 0.0f;
+		MaxMs = 0.0f;
+		MaxFrames = 0;
+		TotalMs = 0.0;
+	}
+
+	void AddSample(const double LatencyMs, const uint64 LatencyFrames)
+	{
+		int32 BucketIndex = 0;
+		while (BucketIndex < BucketUpperBoundsMs.Num() && LatencyMs > BucketUpperBoundsMs[BucketIndex])
+		{
+			++BucketIndex;
+		}
+
+		const int32 Frames = static_cast<int32>(FMath::Min<uint64>(LatencyFrames, MaxFrameLatency));
+		++BucketCounts[BucketIndex];
+		++FrameCounts[Frames];
+		++NumSamples;
+		TotalMs += LatencyMs;
+		AverageMs = TotalMs / NumSamples;
+		MaxMs = FMath::Max(MaxMs, static_cast<float>(LatencyMs));
+		MaxFrames = FMath::Max(MaxFrames, Frames);
+	}
+
+	/**
+	*	Returns the upper bound of the bucket that contains the given percentile (0-100) of samples,
+	*	or the highest recorded latency if it falls in the overflow bucket
+	*/
+	float GetPercentileMs(const float Percentile) const
+	{
+		if (NumSamples == 0)
+		{
+			return 0.0f;
+		}
+
+		const int32 TargetCount = FMath::CeilToInt(NumSamples * FMath::Clamp(Percentile, 0.0f, 100.0f) / 100.0f);
+		int32 Count = 0;
+		for (int32 i = 0; i < BucketUpperBoundsMs.Num(); ++i)
+		{
+			Count += BucketCounts[i];
+			if (Count >= TargetCount)
+			{
+				return FMath::Min(BucketUpperBoundsMs[i], MaxMs);
+			}
+		}
+
+		return MaxMs;
+	}
+
+	FString ToString() const
+	{
+		FString Result = FString::Printf(TEXT("Samples: %d, Average: %.2fms, Max: %.2fms (%d frames), P50: %.2fms, P95: %.2fms, P99: %.2fms\n"),
+			NumSamples, AverageMs, MaxMs, MaxFrames, GetPercentileMs(50.0f), GetPercentileMs(95.0f), GetPercentileMs(99.0f));
+
+		for (int32 i = 0; i < BucketCounts.Num(); ++i)
+		{
+			Result += i < BucketUpperBoundsMs.Num() ?
+				FString::Printf(TEXT("  <= %.1fms: %d\n"), BucketUpperBoundsMs[i], BucketCounts[i]) :
+				FString::Printf(TEXT("  > %.1fms: %d\n"), BucketUpperBoundsMs.Last(), BucketCounts[i]);
+		}
+
+		for (int32 i = 0; i < FrameCounts.Num(); ++i)
+		{
+			Result += FString::Printf(TEXT("  %s%d frames: %d\n"), i == MaxFrameLatency ? TEXT(">= ") : TEXT(""), i, FrameCounts[i]);
+		}
+
+		return Result;
+	}
+
+private:
+
+	double TotalMs = 0.0;
+};
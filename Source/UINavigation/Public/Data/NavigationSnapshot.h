@@ -0,0 +1,30 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UUINavWidget;
+class UUINavComponent;
+
+/**
+* Navigation state of a UINavWidget, taken when it opens a child widget and restored when returning to it
+*/
+struct FNavigationSnapshot
+{
+	// The widget that had navigation, which may be nested in the widget holding the snapshot
+	TWeakObjectPtr<UUINavWidget> Widget;
+
+	TWeakObjectPtr<UUINavComponent> CurrentComponent;
+	TWeakObjectPtr<UUINavComponent> HoveredComponent;
+	TWeakObjectPtr<UUINavComponent> SelectedComponent;
+
+	int32 SectionIndex = INDEX_NONE;
+
+	FVector2D SelectorTranslation = FVector2D::ZeroVector;
+
+	// Hash of the widget tree at the time of the snapshot, so it's only restored if no widgets were added or removed
+	uint32 WidgetTreeHash = 0;
+
+	bool IsSet() const { return Widget.IsValid(); }
+};
@@ -0,0 +1,95 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Templates/SubclassOf.h"
+#include "ParentRetentionPolicy.generated.h"
+
+class UUINavWidget;
+
+/**
+* How a UINavWidget is kept while a child widget that removed it from the viewport is open
+*/
+UENUM(BlueprintType)
+enum class EParentRetentionPolicy : uint8
+{
+	// Removed from the viewport and kept alive, so its Slate widgets are rebuilt on return
+	RemoveFromViewport,
+	// Kept in the viewport but collapsed, so returning to it doesn't rebuild anything
+	KeepHidden,
+	// Removed from the viewport and released once the retained widgets exceed the memory budget, then recreated on return
+	EvictUnderBudget
+};
+
+/**
+* Memory and return latency cost of a parent retention policy
+*/
+USTRUCT(BlueprintType)
+struct FParentRetentionStats
+{
+	GENERATED_BODY()
+
+	FParentRetentionStats() {}
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Retention")
+	int32 NumRetained = 0;
+
+	// Estimated memory of the UObjects kept alive by the retained widgets
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Retention")
+	float RetainedMemoryKB = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Retention")
+	int32 NumEvictions = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Retention")
+	int32 NumReturns = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Retention")
+	float AverageReturnMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Retention")
+	float MaxReturnMs = 0.0f;
+
+	void RecordReturn(const double ReturnMs)
+	{
+		++NumReturns;
+		TotalReturnMs += ReturnMs;
+		AverageReturnMs = TotalReturnMs / NumReturns;
+		MaxReturnMs = FMath::Max(MaxReturnMs, static_cast<float>(ReturnMs));
+	}
+
+private:
+
+	double TotalReturnMs = 0.0;
+};
+
+/**
+* What's needed to recreate an evicted parent widget in the state it was left in
+*/
+USTRUCT()
+struct FEvictedUINavWidget
+{
+	GENERATED_BODY()
+
+	FEvictedUINavWidget() {}
+
+	UPROPERTY()
+	TSubclassOf<UUINavWidget> WidgetClass = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UUINavWidget> ParentWidget = nullptr;
+
+	UPROPERTY()
+	bool bParentRemoved = false;
+
+	UPROPERTY()
+	bool bShouldDestroyParent = false;
+
+	UPROPERTY()
+	FName CurrentComponentName = NAME_None;
+
+	UPROPERTY()
+	int32 SectionIndex = INDEX_NONE;
+
+	bool IsSet() const { return WidgetClass != nullptr; }
+};
@@ -17,6 +17,10 @@ public:
 
 	virtual void OnReturn_Implementation() override;
 
+	virtual void PrewarmPromptData() override;
+
+	virtual void ResetPromptState() override;
+
 	UFUNCTION(BlueprintCallable, Category = SwapKeysWidget)
 	void NotifySwapResult(const bool bSwap);
 	
@@ -28,4 +32,9 @@ public:
 	
 	UPROPERTY()
 	class UUINavInputBox* CollidingInputBox = nullptr;
+
+protected:
+	// Reused for the swap decisions of a single prompt, and replaced when the widget goes back into the prompt pool
+	UPROPERTY()
+	class UPromptDataSwapKeys* SwapKeysPromptData = nullptr;
 };
@@ -0,0 +1,126 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Templates/Function.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UUINavWidget;
+class UUINavPCComponent;
+
+/**
+*	Measures the cost of UINavigation's main operations, used by the UINav.Benchmark console command and the UINavigationTests module
+*/
+namespace UINavBenchmark
+{
+	struct FResult
+	{
+		FString Name;
+		int32 Iterations = 0;
+		double TotalSeconds = 0.0;
+		uint64 TotalFrames = 0;
+		int32 NewObjects = 0;
+	};
+
+	/**
+	*	Counts every UObject created while it exists, including the ones that are destroyed before it's read
+	*/
+	class UINAVIGATION_API FObjectAllocationCounter : public FUObjectArray::FUObjectCreateListener
+	{
+	public:
+
+		FObjectAllocationCounter();
+		virtual ~FObjectAllocationCounter() override;
+
+		virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+		virtual void OnUObjectArrayShutdown() override;
+
+		int32 GetNumAllocations() const { return NumAllocations.GetValue(); }
+
+	private:
+
+		// Objects can be created by the async loading thread
+		FThreadSafeCounter NumAllocations;
+		bool bRegistered = false;
+	};
+
+	/**
+	*	Runs the given function the given number of times in a single frame, after collecting the garbage left by previous measurements
+	*/
+	template<typename FunctionType>
+	void Measure(TArray<FResult>& Results, const FString& Name, const int32 Iterations, FunctionType Function)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		FResult& Result = Results.AddDefaulted_GetRef();
+		Result.Name = Name;
+		Result.Iterations = Iterations;
+
+		const FObjectAllocationCounter AllocationCounter;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Function(i);
+		}
+		Result.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+		Result.NewObjects = AllocationCounter.GetNumAllocations();
+	}
+
+	/**
+	*	Measures the time between opening a widget and the end of its setup, which can complete on a later tick.
+	*	Each widget is closed once its setup completes, and the next one is opened on the following frame.
+	*/
+	class UINAVIGATION_API FOpenWidgetMeasurement
+	{
+	public:
+
+		FOpenWidgetMeasurement(UUINavPCComponent* InUINavPC, TFunction<UUINavWidget*(UUINavPCComponent*)> InOpenWidget, const FString& Name, const int32 Iterations);
+
+		/**
+		*	Advances the measurement, should be called once per frame
+		*
+		*	@return Whether the measurement finished
+		*/
+		bool Update();
+
+		const FResult& GetResult() const { return Result; }
+
+	private:
+
+		// Widgets whose setup doesn't complete within this many frames stop the measurement
+		static constexpr uint64 MaxSetupFrames = 300;
+
+		TWeakObjectPtr<UUINavPCComponent> UINavPC;
+		TFunction<UUINavWidget*(UUINavPCComponent*)> OpenWidget;
+		FResult Result;
+		int32 Iteration = 0;
+		bool bFinished = false;
+
+		TWeakObjectPtr<UUINavWidget> OpenedWidget;
+		double OpenTime = 0.0;
+		uint64 OpenFrame = 0;
+		TUniquePtr<FObjectAllocationCounter> AllocationCounter;
+
+		void CloseOpenedWidget(UUINavWidget* Widget);
+		void Finish();
+	};
+
+	/**
+	*	Measures navigation steps, rebind validation of every input container and input display refreshes on the given player's active widget
+	*/
+	UINAVIGATION_API void MeasureActiveWidget(UUINavPCComponent* UINavPC, const int32 Iterations, TArray<FResult>& Results);
+
+	UINAVIGATION_API FString ToJson(const TArray<FResult>& Results);
+
+	/**
+	*	Writes the given results as JSON to Saved/UINavigation/FileName
+	*
+	*	@return The path of the written file
+	*/
+	UINAVIGATION_API FString WriteResults(const TArray<FResult>& Results, const FString& FileName);
+}
@@ -13,6 +13,7 @@ class UUserWidget;
 class UUINavSettings;
 class UPanelWidget;
 class UUINavComponent;
+class UUINavPCComponent;
 
 /**
  * 
@@ -112,5 +113,12 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = UINavigationLibrary)
 	static bool IsKeyInCategory(const FKey Key, const FString Category);
+
+	// Returns the UINavPCComponent of the first player controller in the given world that has one
+	static UUINavPCComponent* GetFirstUINavPC(const UWorld* World);
+
+	// Replaces the modifiers and triggers of the given mapping with copies owned by the given outer,
+	// so that the mapping can be stored or restored without sharing instances with another context
+	static void DuplicateMappingInstances(struct FEnhancedActionKeyMapping& Mapping, UObject* Outer);
 	
 };
@@ -15,6 +15,7 @@ class UUINavWidget;
 class UTextBlock;
 class URichTextBlock;
 class UScrollBox;
+class UListView;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnClickedEvent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPressedEvent);
@@ -50,6 +51,9 @@ public:
 
 	virtual FReply NativeOnMouseButtonDoubleClick(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
 
@@ -123,6 +127,18 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavComponent)
 	UScrollBox* GetParentScrollBox() const { return ParentScrollBox; }
 
+	/**
+	*	Returns the ListView or TileView that generated this component as one of its entry widgets, if any
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavComponent)
+	UListView* GetOwningListView() const;
+
+	/**
+	*	Returns the list item this entry widget is currently displaying, which changes as the entry gets recycled
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavComponent)
+	UObject* GetListItem() const;
+
 protected:
 
 	virtual FReply NativeOnFocusReceived(const FGeometry& InGeometry, const FFocusEvent& InFocusEvent) override;
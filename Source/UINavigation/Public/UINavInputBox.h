@@ -62,6 +62,9 @@ public:
 
 	UUINavInputBox(const FObjectInitializer& ObjectInitializer);
 
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+
 	virtual void NativeConstruct() override;
 	void CreateEnhancedInputKeyWidgets();
 
@@ -78,7 +81,7 @@ public:
 	void ApplyNegateModifiers(UUINavInputBox* InputBox, FEnhancedActionKeyMapping& Mapping, const bool bNegateX, const bool bNegateY, const bool bNegateZ);
 	void CancelUpdateInputKey(const ERevertRebindReason Reason);
 	void RevertToKeyText(const int Index);
-	bool HasHoldModifier(const FEnhancedActionKeyMapping& ActionMapping);
+	static bool HasHoldModifier(const FEnhancedActionKeyMapping& ActionMapping);
 	void AddHoldModifier(FEnhancedActionKeyMapping& ActionMapping);
 	void RemoveHoldModifier(FEnhancedActionKeyMapping& ActionMapping, const TObjectPtr<UInputTrigger> TriggerToAdd = nullptr);
 	void AutoUpdateInputActionKey(const UInputAction* Action, const FKey& NewKey, const int Index);
@@ -89,7 +92,7 @@ public:
 	int ContainsKey(const FKey& CompareKey) const;
 	FORCEINLINE bool IsAxis() const { return IS_AXIS; }
 	FORCEINLINE bool WantsAxisKey() const;
-	FORCEINLINE FKey GetKey(const int Index) { return Index >= 0 && Index < Keys.Num() ? Keys[Index] : FKey(); }
+	FORCEINLINE FKey GetKey(const int Index) const { return Index >= 0 && Index < Keys.Num() ? Keys[Index] : FKey(); }
 
 	EAxisType AxisType = EAxisType::None;
 
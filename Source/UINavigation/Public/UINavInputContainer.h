@@ -9,15 +9,25 @@
 #include "Data/RevertRebindReason.h"
 #include "Blueprint/UserWidget.h"
 #include "Data/InputContainerEnhancedActionData.h"
+#include "Data/InputConflict.h"
 #include "EnhancedActionKeyMapping.h"
 #include "UINavWidget.h"
 #include "UINavInputContainer.generated.h"
 
 class UPromptDataBase;
+class UInputMappingContext;
+class UUINavInputBox;
 class FReply;
 struct FGeometry;
 struct FFocusEvent;
 
+struct FPendingKeyRebind
+{
+	FName InputName;
+	FKey OldKey;
+	FKey NewKey;
+};
+
 /**
 * This class contains the logic for aggregating several input boxes
 */
@@ -37,6 +47,27 @@ protected:
 
 	class UUINavWidget* ParentWidget = nullptr;
 
+	int32 RebindTransactionDepth = 0;
+
+	// The mappings each input context had before it was first edited in the current rebind transaction
+	TMap<UInputMappingContext*, TArray<FEnhancedActionKeyMapping>> RebindTransactionSnapshots;
+
+	// Keeps the modifier and trigger copies referenced by the snapshots alive until the transaction ends
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> RebindTransactionInstances;
+
+	TArray<FPendingKeyRebind> PendingKeyRebinds;
+
+	// Incremented by each conflict analysis, so that the results of outdated analyses are discarded
+	uint32 InputConflictsAnalysisId = 0;
+
+	bool bAnalyzingInputConflicts = false;
+
+	void PublishInputConflicts(const uint32 AnalysisId, TArray<FInputConflict>&& NewInputConflicts);
+
+	UPROPERTY()
+	TArray<UUINavInputBox*> PendingInputBoxResets;
+
 public:
 
 	virtual void NativeConstruct() override;
@@ -77,6 +108,32 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UINav Input")
 	void ResetKeyMappings();
 
+	/**
+	*	Finds every pair of mappings bound to the same key across all the game's input contexts, in a background task.
+	*	Mappings of this container's inputs only conflict if they share an input group,
+	*	other mappings conflict if they're in the same input context.
+	*	OnInputConflictsAnalyzed is called once the results are published to InputConflicts.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	void AnalyzeInputConflicts();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UINav Input")
+	bool IsAnalyzingInputConflicts() const { return bAnalyzingInputConflicts; }
+
+	/**
+	*	Whether the given input box's key at the given index is part of any of the last analyzed input conflicts
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UINav Input")
+	bool HasInputConflict(const UUINavInputBox* InputBox, const int KeyIndex) const;
+
+	/**
+	*	Called when the results of an input conflict analysis are published
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category = UINavWidget)
+	void OnInputConflictsAnalyzed();
+
+	virtual void OnInputConflictsAnalyzed_Implementation();
+
 	UFUNCTION(BlueprintCallable, Category = "UINav Input")
 	void ForceUpdateInputBoxes();
 
@@ -93,6 +150,29 @@ public:
 
 	void ResetInputBox(const FName InputName, const EInputAxis Axis, const EAxisType AxisType);
 
+	/**
+	*	Starts gathering mapping edits, so that their side effects (saving, rebuilding mappings,
+	*	refreshing navigation keys and input icons) only run once, when the transaction is committed.
+	*	Transactions can be nested, in which case only the outermost commit applies them.
+	*/
+	void BeginRebindTransaction();
+
+	/**
+	*	Stores the current mappings of the given input context, if it hasn't been edited yet in this transaction
+	*/
+	void RecordRebindEdit(UInputMappingContext* InputContext);
+
+	void AddRebindEvent(const FName InputName, const FKey& OldKey, const FKey& NewKey);
+
+	void CommitRebindTransaction();
+
+	/**
+	*	Restores the mappings of every input context edited in this transaction and discards its pending side effects
+	*/
+	void RollbackRebindTransaction();
+
+	bool IsInRebindTransaction() const { return RebindTransactionDepth > 0; }
+
 	UFUNCTION()
 	void OnInputTypeChanged(const EInputType InputType);
 
@@ -120,6 +200,10 @@ public:
 
 	UPROPERTY(BlueprintReadOnly, Category = "UINav Input")
 	TArray<UUINavInputBox*> InputBoxes;
+
+	// The results of the last input conflict analysis
+	UPROPERTY(BlueprintReadOnly, Category = "UINav Input")
+	TArray<FInputConflict> InputConflicts;
 	
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "UINav Input")
 	TMap<UInputMappingContext*, FInputContainerEnhancedActionDataArray> EnhancedInputs;
@@ -3,22 +3,41 @@
 #pragma once
 
 #include "Framework/Application/IInputProcessor.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UUINavPCComponent;
 
 /**
-* 
+* Input preprocessor shared by all local players, which routes each Slate input event
+* to the UINavPCComponent of the user that generated it
 */
 class UINAVIGATION_API FUINavInputProcessor : public IInputProcessor
 {
 
 protected:
-	class UUINavPCComponent* UINavPC = nullptr;
+	// The registered UINavPCs, indexed by their Slate user index.
+	// Weak, since a UINavPC destroyed without EndPlay, such as on world teardown, is never unregistered.
+	TArray<TWeakObjectPtr<UUINavPCComponent>> UINavPCs;
+
+	// Number of registered slots, including stale ones that haven't been pruned yet
+	int32 NumUINavPCs = 0;
+
+	/**
+	*	Frees the slots of UINavPCs that were destroyed without being unregistered
+	*/
+	void PruneStaleUINavPCs();
+
+	UUINavPCComponent* GetUINavPC(const int32 UserIndex) const;
+
+	UUINavPCComponent* GetUINavPCWithActiveWidget(const int32 UserIndex) const;
 
 public:
 
-	void SetUINavPC(UUINavPCComponent* NewUINavPC)
-	{
-		UINavPC = NewUINavPC;
-	}
+	void RegisterUINavPC(UUINavPCComponent* NewUINavPC, const int32 UserIndex);
+
+	void UnregisterUINavPC(UUINavPCComponent* OldUINavPC);
+
+	FORCEINLINE bool HasUINavPCs() const { return NumUINavPCs > 0; }
 	
 	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override;
 
@@ -0,0 +1,24 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "GameFramework/SaveGame.h"
+#include "Data/InputProfile.h"
+#include "UINavInputProfilesSaveGame.generated.h"
+
+/**
+ * Stores the player's named input profiles
+ */
+UCLASS()
+class UINAVIGATION_API UUINavInputProfilesSaveGame : public USaveGame
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TMap<FName, FInputProfile> InputProfiles;
+
+	// The name of the last applied input profile
+	UPROPERTY()
+	FName ActiveInputProfile = NAME_None;
+};
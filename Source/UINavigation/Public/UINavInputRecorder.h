@@ -0,0 +1,122 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "Input/Events.h"
+#include "Containers/Ticker.h"
+
+class UUINavWidget;
+class UUINavComponent;
+class UUINavPCComponent;
+class FArchive;
+
+enum class EUINavRecordedEventType : uint8
+{
+	KeyDown,
+	KeyUp,
+	Analog,
+	MouseMove,
+	MouseButtonDown,
+	MouseButtonUp,
+	MouseWheel,
+	ActiveWidget,
+	Navigation,
+};
+
+/**
+* A single input event or focus transition, stored relative to the frame the recording started on
+*/
+struct FUINavRecordedEvent
+{
+	uint32 Frame = 0;
+	EUINavRecordedEventType Type = EUINavRecordedEventType::KeyDown;
+	uint8 UserIndex = 0;
+	bool bIsRepeat = false;
+	// Key for input events, widget class path for transitions
+	uint16 NameIndex = 0;
+	// Component name for navigation transitions
+	uint16 SecondNameIndex = 0;
+	float Value = 0.0f;
+	FVector2f Position = FVector2f::ZeroVector;
+	// Modifier keys held during input events, one bit per FModifierKeysState flag
+	uint16 ModifierKeys = 0;
+	// Character and platform key codes of key events, so text input replays like it was recorded
+	uint32 CharacterCode = 0;
+	uint32 KeyCode = 0;
+
+	bool IsTransition() const { return Type == EUINavRecordedEventType::ActiveWidget || Type == EUINavRecordedEventType::Navigation; }
+};
+
+/**
+* Records the input events received by the UINav input processor, along with the resulting active widget and navigation transitions,
+* into a compact binary file that can later be replayed through Slate to benchmark a session and verify that the same focus path occurs.
+* Replays are frame based, so they should run with a fixed frame rate (-benchmark -fps=60) for the results to be deterministic.
+*/
+class UINAVIGATION_API FUINavInputRecorder
+{
+public:
+
+	static FUINavInputRecorder& Get();
+
+	FORCEINLINE bool IsRecording() const { return bRecording; }
+	FORCEINLINE bool IsReplaying() const { return bReplaying; }
+
+	bool StartRecording(UUINavPCComponent* UINavPC);
+	bool StopRecording(const FString& FilePath);
+
+	bool StartReplay(const FString& FilePath, UUINavPCComponent* UINavPC);
+	void StopReplay();
+
+	void RecordKeyEvent(const EUINavRecordedEventType Type, const FKeyEvent& KeyEvent);
+	void RecordAnalogEvent(const FAnalogInputEvent& AnalogEvent);
+	void RecordPointerEvent(const EUINavRecordedEventType Type, const FPointerEvent& PointerEvent);
+
+	void NotifyActiveWidgetChanged(const UUINavWidget* NewActiveWidget);
+	void NotifyNavigatedTo(const UUINavWidget* Widget, const UUINavComponent* Component);
+
+	static FString GetRecordingPath(const FString& Name);
+
+private:
+
+	static constexpr uint32 FileMagic = 0x524E4955; // "UINR"
+	static constexpr uint32 FileVersion = 2;
+
+	// Frames the replay keeps running after its last event, for transitions that happen a frame or more after their input
+	static constexpr uint32 MaxReplayGraceFrames = 30;
+
+	bool bRecording = false;
+	bool bReplaying = false;
+
+	uint64 StartFrame = 0;
+	double ReplayStartTime = 0.0;
+	uint32 ReplayFrame = 0;
+	int32 NextReplayEvent = 0;
+	int32 NumRecordedTransitions = 0;
+
+	// Frame and time at which the last recorded event was replayed, before the grace frames
+	uint32 ReplayEndFrame = 0;
+	double ReplayEndTime = 0.0;
+
+	TArray<FString> Names;
+	TMap<FString, uint16> NameIndices;
+	TArray<FUINavRecordedEvent> Events;
+
+	// Transitions that happened during the replay, compared against the recorded ones once it ends
+	TArray<FUINavRecordedEvent> ReplayedTransitions;
+
+	FTSTicker::FDelegateHandle ReplayTickerHandle;
+
+	uint16 GetNameIndex(const FString& Name);
+	FUINavRecordedEvent& AddEvent(const EUINavRecordedEventType Type, const uint32 UserIndex);
+	void AddTransition(const EUINavRecordedEventType Type, const FString& WidgetName, const FString& ComponentName);
+
+	static uint16 PackModifierKeys(const FModifierKeysState& ModifierKeys);
+	static FModifierKeysState UnpackModifierKeys(const uint16 ModifierKeys);
+
+	bool Serialize(FArchive& Ar);
+	bool TickReplay(float DeltaTime);
+	void ReplayEvent(const FUINavRecordedEvent& Event) const;
+	void FinishReplay();
+};
@@ -3,10 +3,20 @@
 #pragma once
 
 #include "Subsystems/LocalPlayerSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/StreamableManager.h"
+#include "Data/InputProfile.h"
 #include "UINavLocalPlayerSubsystem.generated.h"
 
 class FSubsystemCollectionBase;
 class UInputMappingContext;
+class UUINavInputProfilesSaveGame;
+struct FEnhancedActionKeyMapping;
+struct FInputMappingArray;
+struct FInputMappingOverride;
+struct FUINavEnhancedActionKeyMapping;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FInputContextsAppliedDelegate);
 
 /**
  * 
@@ -15,11 +25,176 @@ UCLASS()
 class UINAVIGATION_API UUINavLocalPlayerSubsystem : public ULocalPlayerSubsystem
 {
 	GENERATED_BODY()
+
+protected:
+	FTimerHandle SaveInputContextsTimerHandle;
+
+	bool bInputContextsDirty = false;
+
+	/**
+	*	Drops any pending write, for when the saved input settings are about to be written to disk by SaveConfig instead
+	*/
+	void CancelPendingInputContextsWrite();
+
+	FStreamableManager StreamableManager;
+
+	TSharedPtr<FStreamableHandle> InputContextsLoadHandle;
+
+	// The finish function of the load in flight, unbound once it has run
+	FStreamableDelegate PendingInputContextsLoadedDelegate;
+
+	// Identifies the load in flight, so that callbacks of older loads don't touch a newer one
+	uint32 InputContextsLoadSerial = 0;
+
+	/**
+	*	Runs the finish function of the given load if it's still the current one and hasn't run yet
+	*/
+	void FinishInputContextsLoad(const uint32 LoadSerial);
+
+	void OnSaveInputContextsTimerFinished();
+
+	/**
+	*	Requests all the given assets in a single batch and calls the given delegate once they're loaded
+	*/
+	void LoadInputContextsAssets(TArray<FSoftObjectPath>&& AssetPaths, const FStreamableDelegate& LoadedDelegate);
+
+	static void GetInputMappingAssetPaths(const FUINavEnhancedActionKeyMapping& Mapping, TSet<FSoftObjectPath>& OutAssetPaths);
+
+	void FinishApplySavedInputContexts();
+
+	void FinishResetInputContexts();
+
+	void NotifyInputContextsApplied();
+
+	/**
+	*	Gets the overrides needed to turn the given default mappings into the given current mappings
+	*/
+	static void GetInputMappingOverrides(const FInputMappingArray* DefaultMappings, const TArray<FEnhancedActionKeyMapping>& CurrentMappings, TArray<FInputMappingOverride>& OutOverrides);
+
+	/**
+	*	Patches the mappings of the given input context in place, according to the given overrides
+	*/
+	static void ApplyInputMappingOverrides(UInputMappingContext* InputContext, const FInputMappingArray* DefaultMappings, const TArray<FInputMappingOverride>& Overrides);
+
+	static void CopyInputMapping(const FUINavEnhancedActionKeyMapping& SourceMapping, FEnhancedActionKeyMapping& TargetMapping);
+
+	// This player's copy of each input context, if bUsePerPlayerInputContexts is enabled
+	UPROPERTY()
+	TMap<TObjectPtr<const UInputMappingContext>, TObjectPtr<UInputMappingContext>> PlayerInputContexts;
+
+	// This player's saved overrides, used instead of the shared saved input settings by secondary players
+	TMap<TSoftObjectPtr<UInputMappingContext>, FInputMappingOverrideArray> PlayerInputMappingOverrides;
+
+	bool bLoadedPlayerInputMappingOverrides = false;
+
+	/**
+	*	Whether this player's bindings are saved separately from the shared saved input settings
+	*/
+	bool UsesPlayerSaveData() const;
+
+	TMap<TSoftObjectPtr<UInputMappingContext>, FInputMappingOverrideArray>& GetSavedInputMappingOverrides();
+
+	FString GetSavedInputMappingOverridesKey() const;
+
+	int32 GetSaveUserIndex() const;
+
+	UInputMappingContext* LoadPlayerInputContext(const TSoftObjectPtr<UInputMappingContext>& InputContextPtr);
+
+	UPROPERTY()
+	UUINavInputProfilesSaveGame* InputProfilesSaveGame = nullptr;
+
+	UPROPERTY()
+	TMap<FName, FResolvedInputProfile> ResolvedInputProfiles;
+
+	/**
+	*	Loads the input profiles save, or creates it if it doesn't exist yet, and resolves its profiles
+	*/
+	UUINavInputProfilesSaveGame* GetInputProfilesSaveGame();
+
+	void WriteInputProfiles();
+
+	/**
+	*	Loads the assets referenced by the given profile and applies its overrides to the default mappings
+	*/
+	static void ResolveInputProfile(const FInputProfile& InputProfile, FResolvedInputProfile& OutResolvedInputProfile);
 	
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 
+	virtual void Deinitialize() override;
+
+	/**
+	*	Gets this player's copy of the given input context if bUsePerPlayerInputContexts is enabled,
+	*	or the given input context otherwise
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	UInputMappingContext* GetPlayerInputContext(const UInputMappingContext* InputContext);
+
+	/**
+	*	Gets the input context asset that the given player input context was copied from
+	*/
+	const UInputMappingContext* GetSourceInputContext(const UInputMappingContext* InputContext) const;
+
+	/**
+	*	Stores the mappings of the given input context and schedules them to be written to disk
+	*	once no other changes happen for InputSaveDelay seconds
+	*/
 	void SaveInputContextState(UInputMappingContext* InputContext);
+
+	/**
+	*	Writes any pending input context changes to the config cache and flushes the saved input settings' ini file to disk.
+	*	The file is only written through the config cache, on the game thread, so that it can't race SaveConfig or other players' flushes.
+	*/
+	void FlushInputContextStates();
 	
+	/**
+	*	Applies the saved input mappings to their input contexts.
+	*	If bLoadInputContextsAsync is enabled, the mappings are applied once their assets finish loading.
+	*/
 	void ApplySavedInputContexts();
+
+	/**
+	*	Resets the input contexts to their default mappings and clears the saved input mappings.
+	*	If bLoadInputContextsAsync is enabled, the mappings are applied once their assets finish loading.
+	*/
+	void ResetInputContexts();
+
+	/**
+	*	Blocks until the input context assets being loaded finish loading and their mappings are applied
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	void WaitForInputContexts();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UINav Input")
+	bool IsLoadingInputContexts() const;
+
+	/**
+	*	Stores the current mappings of every known input context in the input profile with the given name
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	void SaveInputProfile(const FName ProfileName);
+
+	/**
+	*	Replaces the mappings of the input profile's input contexts with the ones stored in that profile
+	*
+	*	@return Whether the input profile exists
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	bool ApplyInputProfile(const FName ProfileName);
+
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	bool DeleteInputProfile(const FName ProfileName);
+
+	/**
+	*	Not pure, since the first call loads the input profiles save and resolves its profiles
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	TArray<FName> GetInputProfileNames();
+
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	FName GetActiveInputProfile();
+
+	// Called when the saved or default input mappings have been applied to their input contexts
+	UPROPERTY(BlueprintAssignable, Category = "UINav Input")
+	FInputContextsAppliedDelegate InputContextsAppliedDelegate;
 };
@@ -16,23 +16,29 @@
 #include "EnhancedInputComponent.h"
 #include "Input/Reply.h"
 #include "InputAction.h"
+#include "EnhancedActionKeyMapping.h"
+#include "UObject/ObjectKey.h"
 #include "Data/InputContainerEnhancedActionData.h"
 #include "Data/PlatformConfigData.h"
 #include "Delegates/DelegateCombinations.h"
 #include "Misc/CoreMiscDefines.h"
 #include "UObject/SoftObjectPtr.h"
 #include "Data/PromptData.h"
+#include "Data/NavigationLatency.h"
+#include "Data/ParentRetentionPolicy.h"
 #include "Misc/CoreMiscDefines.h"
 #include "UINavPCComponent.generated.h"
 
 class APlayerController;
-class FUINavInputProcessor;
 class UUINavInputBox;
+class UInputModifierNegate;
 class UTexture2D;
 class UUINavWidget;
+class UUINavComponent;
 class UUINavPromptWidget;
 class UInputMappingContext;
 class UCurveFloat;
+class UScrollBox;
 class FText;
 class UGameViewportClient;
 struct FEnhancedActionKeyMapping;
@@ -75,6 +81,57 @@ struct FGameViewportRerouteData
 	EInputEvent InputEvent;
 };
 
+struct FAnalogInputState
+{
+	FVector2D LeftStick = FVector2D::ZeroVector;
+	FVector2D RightStick = FVector2D::ZeroVector;
+	float MaxAnalogValue = 0.0f;
+
+	bool bReceivedLeftX = false;
+	bool bReceivedLeftY = false;
+	bool bReceivedRightX = false;
+	bool bReceivedRightY = false;
+	bool bReceivedInput = false;
+
+	void ResetReceivedInput()
+	{
+		MaxAnalogValue = 0.0f;
+		bReceivedLeftX = bReceivedLeftY = bReceivedRightX = bReceivedRightY = false;
+		bReceivedInput = false;
+	}
+};
+
+// The axis, sign and hold information of an input mapping, extracted from its modifiers and triggers
+struct FInputMappingDescriptor
+{
+	FInputMappingDescriptor() {}
+	FInputMappingDescriptor(const FEnhancedActionKeyMapping& Mapping);
+
+	// Used to detect whether the mapping changed since this descriptor was built
+	FKey Key;
+	const UInputAction* Action = nullptr;
+	const UObject* LastModifier = nullptr;
+	const UObject* FirstTrigger = nullptr;
+	int32 NumModifiers = 0;
+	int32 NumTriggers = 0;
+	// Negate modifiers get their axes flipped in place when rebinding, so their flags are part of the fingerprint
+	const UInputModifierNegate* MappingNegate = nullptr;
+	bool bMappingNegateX = false;
+	bool bMappingNegateY = false;
+	bool bMappingNegateZ = false;
+
+	EInputAxis SwizzleAxis = EInputAxis::X;
+	bool bHasNegate = false;
+	bool bNegateX = false;
+	bool bNegateY = false;
+	bool bNegateZ = false;
+	bool bIsHold = false;
+
+	bool Matches(const FEnhancedActionKeyMapping& Mapping) const;
+
+	void GetAxisProperties(const bool bIsAxis2D, bool& bOutPositive, EInputAxis& OutAxis) const;
+};
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class UINAVIGATION_API UUINavPCComponent : public UActorComponent
 {
@@ -103,6 +160,40 @@ protected:
 
 	bool bAutomaticNavigation = false;
 
+	// Time and frame at which the last navigation input reached the input processor, consumed by TryNavigateInDirection.
+	// Cleared when the input ends without navigating, so a stamp is never attributed to a later input's navigation.
+	double PendingNavigationInputTime = 0.0;
+	uint64 PendingNavigationInputFrame = 0;
+
+	// Time and frame of the input that started the navigation in progress, recorded once NavigatedTo finishes.
+	// Replaced by the next navigation, and cleared by new inputs, so a navigation that never finishes isn't recorded.
+	double NavigationLatencyStartTime = 0.0;
+	uint64 NavigationLatencyStartFrame = 0;
+
+	FNavigationLatencyHistogram NavigationLatency;
+
+	struct FRetainedParent
+	{
+		TWeakObjectPtr<UUINavWidget> Widget;
+		// The widget that removed it, which releases it on eviction
+		TWeakObjectPtr<UUINavWidget> ChildWidget;
+		EParentRetentionPolicy Policy = EParentRetentionPolicy::RemoveFromViewport;
+		int64 EstimatedBytes = 0;
+	};
+
+	// Parent widgets currently removed or hidden by a child widget, least recently removed first
+	TArray<FRetainedParent> RetainedParents;
+
+	TMap<EParentRetentionPolicy, FParentRetentionStats> ParentRetentionStats;
+
+	void EvictRetainedParentsOverBudget();
+	void RemoveRetainedParentAt(const int32 Index);
+	static int64 EstimateWidgetMemory(const UUINavWidget* Widget);
+
+	// Dismissed prompt widgets waiting to be reused, of any class
+	UPROPERTY()
+	TArray<UUINavPromptWidget*> PooledPromptWidgets;
+
 	bool bUsingThumbstickAsMouse = false;
 
 	bool bWaitingForInputCooldown = false;
@@ -110,7 +201,13 @@ protected:
 	UPROPERTY()
 	APlayerController* PC = nullptr;
 
-	TSharedPtr<FUINavInputProcessor> SharedInputProcessor = nullptr;
+	bool bRegisteredInputProcessor = false;
+
+	// Whether registering with the input processor is waiting for the local player's Slate user to exist
+	bool bPendingInputProcessorRegistration = false;
+
+	// Valid while a control mappings rebuild is pending for the end of the frame
+	FDelegateHandle RebuildMappingsHandle;
 
 	FVector2D ThumbstickDelta = FVector2D::ZeroVector;
 
@@ -123,6 +220,10 @@ protected:
 
 	EUINavigation CallbackDirection;
 	float TimerCounter = 0.f;
+	float ChainHeldTime = 0.f;
+
+	// The component that the navigation performed by a chain page step lands on
+	TWeakObjectPtr<UUINavComponent> PageNavigationDestination = nullptr;
 
 	float InputCooldownTime = 0.0f;
 
@@ -130,6 +231,9 @@ protected:
 
 	bool bReceivedAnalogInput = false;
 
+	float RightThumbstickScrollVelocity = 0.0f;
+	TWeakObjectPtr<UScrollBox> RightThumbstickScrollBox = nullptr;
+
 	bool bIgnoreFocusByNavigation = false;
 
 	bool bOverrideConsiderHover = false;
@@ -153,6 +257,12 @@ protected:
 
 	FGameViewportRerouteData GameViewportRerouteData;
 
+	// The analog samples received since the last tick, per user index
+	TMap<int32, FAnalogInputState> AnalogInputStates;
+
+	// The descriptor of each mapping of the input contexts queried so far, in the same order as the context's mappings
+	mutable TMap<TObjectKey<UInputMappingContext>, TArray<FInputMappingDescriptor>> MappingDescriptors;
+
 	static const FKey MouseUp;
 	static const FKey MouseDown;
 	static const FKey MouseRight;
@@ -160,50 +270,9 @@ protected:
 
 	static bool bInitialized;
 
-	TMap<FKey, FAxis2D_Keys> Axis2DToAxis1DMap = {
-		{EKeys::Gamepad_Left2D, {EKeys::Gamepad_LeftX, EKeys::Gamepad_LeftY}},
-		{EKeys::Gamepad_Right2D, {EKeys::Gamepad_RightX, EKeys::Gamepad_RightY}},
-		{EKeys::Mouse2D, {EKeys::MouseX, EKeys::MouseY}},
-	};
-
-	TMap<FKey, FAxis2D_Keys> AxisToKeyMap = {
-		{EKeys::Gamepad_LeftX, {EKeys::Gamepad_LeftStick_Right, EKeys::Gamepad_LeftStick_Left}},
-		{EKeys::Gamepad_LeftY, {EKeys::Gamepad_LeftStick_Up, EKeys::Gamepad_LeftStick_Down}},
-		{EKeys::Gamepad_RightX, {EKeys::Gamepad_RightStick_Right, EKeys::Gamepad_RightStick_Left}},
-		{EKeys::Gamepad_RightY, {EKeys::Gamepad_RightStick_Up, EKeys::Gamepad_RightStick_Down}},
-		{EKeys::MouseX, {MouseRight, MouseLeft}},
-		{EKeys::MouseY, {MouseUp, MouseDown}},
-		{EKeys::MouseWheelAxis, {EKeys::MouseScrollUp, EKeys::MouseScrollDown}},
-		{EKeys::MixedReality_Left_Thumbstick_X, {EKeys::MixedReality_Left_Thumbstick_Right, EKeys::MixedReality_Left_Thumbstick_Left}},
-		{EKeys::MixedReality_Left_Thumbstick_Y, {EKeys::MixedReality_Left_Thumbstick_Up, EKeys::MixedReality_Left_Thumbstick_Down}},
-		{EKeys::MixedReality_Right_Thumbstick_X, {EKeys::MixedReality_Right_Thumbstick_Right, EKeys::MixedReality_Right_Thumbstick_Left}},
-		{EKeys::MixedReality_Right_Thumbstick_Y, {EKeys::MixedReality_Right_Thumbstick_Up, EKeys::MixedReality_Right_Thumbstick_Down}},
-		{EKeys::OculusTouch_Left_Thumbstick_X, {EKeys::OculusTouch_Left_Thumbstick_Right, EKeys::OculusTouch_Left_Thumbstick_Left}},
-		{EKeys::OculusTouch_Left_Thumbstick_Y, {EKeys::OculusTouch_Left_Thumbstick_Up, EKeys::OculusTouch_Left_Thumbstick_Down}},
-		{EKeys::OculusTouch_Right_Thumbstick_X, {EKeys::OculusTouch_Right_Thumbstick_Right, EKeys::OculusTouch_Right_Thumbstick_Left}},
-		{EKeys::OculusTouch_Right_Thumbstick_Y, {EKeys::OculusTouch_Right_Thumbstick_Up, EKeys::OculusTouch_Right_Thumbstick_Down}},
-		{EKeys::ValveIndex_Left_Thumbstick_X, {EKeys::ValveIndex_Left_Thumbstick_Right, EKeys::ValveIndex_Left_Thumbstick_Left}},
-		{EKeys::ValveIndex_Left_Thumbstick_Y, {EKeys::ValveIndex_Left_Thumbstick_Up, EKeys::ValveIndex_Left_Thumbstick_Down}},
-		{EKeys::ValveIndex_Right_Thumbstick_X, {EKeys::ValveIndex_Right_Thumbstick_Right, EKeys::ValveIndex_Right_Thumbstick_Left}},
-		{EKeys::ValveIndex_Right_Thumbstick_Y, {EKeys::ValveIndex_Right_Thumbstick_Up, EKeys::ValveIndex_Right_Thumbstick_Down}},
-		{EKeys::Vive_Left_Trackpad_X, {EKeys::Vive_Left_Trackpad_Right, EKeys::Vive_Left_Trackpad_Left}},
-		{EKeys::Vive_Left_Trackpad_Y, {EKeys::Vive_Left_Trackpad_Up, EKeys::Vive_Left_Trackpad_Down}},
-		{EKeys::Vive_Right_Trackpad_X, {EKeys::Vive_Right_Trackpad_Right, EKeys::Vive_Right_Trackpad_Left}},
-		{EKeys::Vive_Right_Trackpad_Y, {EKeys::Vive_Right_Trackpad_Up, EKeys::Vive_Right_Trackpad_Down}},
-	};
-
-	TMap<FKey, FKey> KeyToAxisMap = {
-		{EKeys::Gamepad_LeftTrigger, EKeys::Gamepad_LeftTriggerAxis},
-		{EKeys::Gamepad_RightTrigger, EKeys::Gamepad_RightTriggerAxis},
-		{EKeys::MixedReality_Left_Trigger_Click, EKeys::MixedReality_Left_Trigger_Axis},
-		{EKeys::MixedReality_Right_Trigger_Click, EKeys::MixedReality_Right_Trigger_Axis},
-		{EKeys::OculusTouch_Left_Grip_Click, EKeys::OculusTouch_Left_Grip_Axis},
-		{EKeys::OculusTouch_Right_Grip_Click, EKeys::OculusTouch_Right_Grip_Axis},
-		{EKeys::ValveIndex_Left_Trigger_Click, EKeys::ValveIndex_Left_Trigger_Axis},
-		{EKeys::ValveIndex_Right_Trigger_Click, EKeys::ValveIndex_Right_Trigger_Axis},
-		{EKeys::Vive_Left_Trigger_Click, EKeys::Vive_Left_Trigger_Axis},
-		{EKeys::Vive_Right_Trigger_Click, EKeys::Vive_Right_Trigger_Axis},
-	};
+	// The relations between axis keys and their 1D axes, 2D axes and directional keys, shared by every instance
+	struct FAxisKeyRelations;
+	static const FAxisKeyRelations& GetAxisKeyRelations();
 
 	TArray<FKey> GamepadSelectKeys;
 
@@ -217,8 +286,25 @@ protected:
 
 	void InitPlatformData();
 
+	/**
+	*	Registers this component with the input processor under its local player's Slate user index
+	*
+	*	@return Whether the local player already has a Slate user
+	*/
+	bool TryRegisterInputProcessor();
+
 	void ClearNavigationTimer();
 
+	void TickNavigationChain(const float DeltaTime);
+
+	float GetNavigationChainInterval() const;
+
+	bool TryNavigatePageInDirection(const EUINavigation Direction, const int32 NumSteps);
+
+	void ProcessAnalogInputState(const FAnalogInputState& AnalogInputState);
+
+	void TickRightThumbstickScroll(const float DeltaTime);
+
 	/**
 	*	Returns the input type of the given key
 	*
@@ -296,6 +382,35 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = UINavController)
 	float NavigationChainFrequency = 0.15f;
 
+	/*
+	The amount of time the navigation needs to be chaining before it starts accelerating
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = UINavController)
+	float ChainAccelerationDelay = 1.0f;
+
+	/*
+	A float curve that dictates how much faster the navigation chains (as a multiplier of NavigationChainFrequency)
+	in relation to the time passed since the acceleration started. If not set, the navigation won't accelerate.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = UINavController)
+	UCurveFloat* ChainAccelerationCurve = nullptr;
+
+	/*
+	The maximum amount of chained navigations that can happen in a single frame
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = UINavController, meta = (ClampMin = 1))
+	int32 MaxChainStepsPerFrame = 4;
+
+	/*
+	Indicates whether, when more chained navigations are due in a frame than MaxChainStepsPerFrame,
+	they should all be performed at once by jumping over that many components in the current component's parent panel.
+	The jump is a single navigation, so it respects the current component's navigation rules and triggers the usual navigation events.
+	Page steps are supported in vertical and horizontal boxes, scroll boxes and grid panels, as well as Next and Previous in any panel.
+	Otherwise, or if false, only MaxChainStepsPerFrame navigations are performed and the extra ones are discarded.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = UINavController)
+	bool bUseChainPageSteps = true;
+
 	/*
 	Indicates whether the controller should use the left or right stick as mouse.
 	If the active UINavWidget has this set to a value different than None, it will override this one.
@@ -347,6 +462,26 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = UINavController)
 	float RightThumbstickScrollSensitivity = 20.0f;
 
+	/*
+	A float curve that dictates how much the right thumbstick scrolls in relation to the sensitivity
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = UINavController)
+	UCurveFloat* RightThumbstickScrollCurve = nullptr;
+
+	/*
+	How quickly the scrolling speed approaches the one given by the right thumbstick's position while it's held.
+	If set to 0, the scrolling speed follows the thumbstick right away.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = UINavController, meta = (ClampMin = 0.0f))
+	float RightThumbstickScrollAcceleration = 10.0f;
+
+	/*
+	How quickly the scrolling slows down after the right thumbstick is released.
+	If set to 0, scrolling stops as soon as the thumbstick is released.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = UINavController, meta = (ClampMin = 0.0f))
+	float RightThumbstickScrollDamping = 0.0f;
+
 	/*
 	The required value for an axis to be considered for rebinding
 	*/
@@ -403,6 +538,11 @@ public:
 	FORCEINLINE bool AllowsSectionInput() const { return bAllowSectionInput; }
 
 	FORCEINLINE bool AllowsNavigatingDirection(const EUINavigation Direction) const { return AllowsDirectionalInput() || (AllowDirection != EUINavigation::Invalid && AllowDirection != Direction); }
+
+	/**
+	*	Returns the component that the navigation being performed should land on instead of the adjacent one, if it's a chain page step
+	*/
+	UUINavComponent* GetPageNavigationDestination() const;
 	
 	EThumbstickAsMouse UsingThumbstickAsMouse() const;
 
@@ -461,8 +601,14 @@ public:
 	void SetIgnoreFocusByNavigation(const bool bIgnore) { bIgnoreFocusByNavigation = bIgnore; }
 	bool IgnoreFocusByNavigation() const { return bIgnoreFocusByNavigation; }
 
+	/**
+	*	Requests a rebuild of this player's control mappings.
+	*	Multiple requests in the same frame are merged into a single rebuild at the end of the frame.
+	*/
 	void RequestRebuildMappings();
 
+	void FlushRebuildMappings();
+
 	void AddInputContextFromUINavWidget(UUINavWidget* UINavWidget, const UUINavWidget* const ParentLimit = nullptr);
 	void RemoveInputContextFromUINavWidget(UUINavWidget* UINavWidget, const UUINavWidget* const ParentLimit = nullptr);
 	
@@ -474,6 +620,13 @@ public:
 	void AddInputContext(const UInputMappingContext* const Context, const int32 Priority = 0);
 	UFUNCTION(BlueprintCallable, Category = "Input")
 	void RemoveInputContext(const UInputMappingContext* const Context);
+
+	/**
+	*	Gets this player's copy of the given input context, if bUsePerPlayerInputContexts is enabled
+	*/
+	const UInputMappingContext* GetPlayerInputContext(const UInputMappingContext* const Context) const;
+
+	const TArray<const UInputMappingContext*>& GetCachedInputContexts() const { return CachedInputContexts; }
 		
 	void HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
 	void HandleKeyUpEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent);
@@ -540,6 +693,22 @@ public:
 	const FKey GetOppositeAxis2DAxis(const FKey& Key) const;
 
 	void GetAxisPropertiesFromMapping(const FEnhancedActionKeyMapping& ActionMapping, bool& bOutPositive, EInputAxis& OutAxis) const;
+
+	/**
+	*	Same as above, but reads the cached descriptor of the mapping at the given index of the given input context
+	*/
+	void GetAxisPropertiesFromMapping(const UInputMappingContext* InputContext, const int32 MappingIndex, bool& bOutPositive, EInputAxis& OutAxis) const;
+
+	/**
+	*	Gets the cached descriptor of the mapping at the given index of the given input context,
+	*	rebuilding it if the mapping changed since it was cached
+	*/
+	const FInputMappingDescriptor& GetMappingDescriptor(const UInputMappingContext* InputContext, const int32 MappingIndex) const;
+
+	/**
+	*	Clears the cached mapping descriptors of the given input context, or of every input context if none is given
+	*/
+	void InvalidateMappingDescriptors(const UInputMappingContext* InputContext = nullptr);
 	
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
 	bool IsAxis2D(const FKey& Key) const;
@@ -613,6 +782,32 @@ public:
 	UFUNCTION(BlueprintCallable, Category = UINavWidget, meta = (AdvancedDisplay = 4, DeterminesOutputType = "NewWidgetClass"))
 	UUINavWidget* GoToPromptWidget(TSubclassOf<UUINavPromptWidget> NewWidgetClass, const FPromptWidgetDecided& Event, const FText Title = FText(), const FText Message = FText(), const bool bRemoveParent = false, const int ZOrder = 0);
 
+	/**
+	*	Returns a pooled prompt widget of the given class, or creates one if none is available
+	*/
+	UUINavPromptWidget* AcquirePromptWidget(TSubclassOf<UUINavPromptWidget> WidgetClass);
+
+	/**
+	*	Puts a dismissed prompt widget back into the pool, unless it's still on screen or the pool for its class is full
+	*/
+	void ReleasePromptWidget(UUINavPromptWidget* Widget);
+
+	/**
+	*	Creates prompt widgets of the given class ahead of time, along with their prompt data,
+	*	so that the first prompts shown don't allocate
+	*
+	*	@param	WidgetClass  The class of the prompt widgets to create
+	*	@param	Count  How many widgets of this class the pool should hold, capped by MaxPooledPromptWidgets
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController, meta = (AdvancedDisplay = 1))
+	void PrewarmPromptWidgets(TSubclassOf<UUINavPromptWidget> WidgetClass, const int32 Count = 1);
+
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void ClearPromptWidgetPool();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	int32 GetNumPooledPromptWidgets(TSubclassOf<UUINavPromptWidget> WidgetClass) const;
+
 	/**
 	*	Adds given widget to screen (strongly recommended over manual alternative)
 	*
@@ -652,6 +847,53 @@ public:
 
 	bool TryNavigateInDirection(const EUINavigation Direction, const ENavigationGenesis Genesis);
 
+	/**
+	*	Called by the input processor when an input event arrives, so the navigation it triggers can be timed
+	*
+	*	@param	bOverwrite  Whether to replace a timestamp that hasn't been consumed by a navigation yet
+	*/
+	void StampNavigationInput(const bool bOverwrite);
+	void ClearNavigationInputStamp();
+	void RecordNavigationLatency();
+
+	/**
+	*	Drops the input stamp and the navigation in progress, for inputs after which a pending navigation can't be attributed to them anymore
+	*/
+	void AbandonNavigationLatency();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	const FNavigationLatencyHistogram& GetNavigationLatency() const { return NavigationLatency; }
+
+	/**
+	*	Returns the input-to-visual navigation latency, in milliseconds, below which the given percentage of navigations fall
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	float GetNavigationLatencyPercentile(const float Percentile) const { return NavigationLatency.GetPercentileMs(Percentile); }
+
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void ResetNavigationLatency();
+
+	/**
+	*	Called when a child widget removes or hides the given widget
+	*
+	*	@param	Widget  The retained widget
+	*	@param	ChildWidget  The child widget that removed it, which is needed to evict it
+	*/
+	void NotifyParentRetained(UUINavWidget* Widget, UUINavWidget* ChildWidget = nullptr);
+
+	/**
+	*	Called once a retained widget is back on screen, with the time it took to restore it
+	*/
+	void NotifyParentRestored(UUINavWidget* Widget, const double ReturnMs);
+
+	/**
+	*	Called when a retained widget is removed for good, without returning to it
+	*/
+	void NotifyParentDiscarded(UUINavWidget* Widget);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	FParentRetentionStats GetParentRetentionStats(const EParentRetentionPolicy Policy) const;
+
 	void ClearAnalogKeysFromPressedKeys(const FKey& PressedKey);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
@@ -33,6 +33,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UINavPromptWidget")
 	void ExecuteCallback(UPromptDataBase* InPromptData);
 
+	/**
+	*	Creates the prompt data objects this widget reuses for its decisions, so the first decision doesn't allocate
+	*/
+	virtual void PrewarmPromptData();
+
+	/**
+	*	Clears the state of the last prompt before this widget goes back into the UINavPC's prompt pool,
+	*	and creates new prompt data objects, since the callback of the last prompt may still hold the previous ones
+	*/
+	virtual void ResetPromptState();
+
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UINavPromptWidget")
 	FText Title;
@@ -63,5 +74,14 @@ protected:
 	URichTextBlock* MessageRichText = nullptr;
 
 	FPromptWidgetDecided Callback;
+
+	/**
+	*	Returns this widget's binary prompt data set to the given decision.
+	*	The object is replaced when the widget goes back into the prompt pool, so callbacks can hold on to it.
+	*/
+	UPromptDataBinary* GetBinaryPromptData(const bool bAccept);
+
+	UPROPERTY()
+	UPromptDataBinary* BinaryPromptData = nullptr;
 	
 };
@@ -5,6 +5,7 @@
 #include "UObject/Object.h"
 #include "InputMappingContext.h"
 #include "Data/InputMappingArray.h"
+#include "Data/InputMappingOverride.h"
 #include "UINavSavedInputSettings.generated.h"
 
 /**
@@ -19,10 +20,15 @@ class UINAVIGATION_API UUINavSavedInputSettings : public UObject
 	: Super(ObjectInitializer) {}
 
 public:
-	// A map for each Input Context that's been overriden in your game and its respective Input Context Mappings
+	// A map for each Input Context that's been overriden in your game and its respective Input Context Mappings.
+	// Only used by saves from older versions, which are converted to SavedInputMappingOverrides when the Input Context is saved again.
 	UPROPERTY(config)
 	TMap<TSoftObjectPtr<UInputMappingContext>, FInputMappingArray> SavedEnhancedInputMappings;
 
+	// A map for each Input Context that's been overriden in your game and the mappings that differ from its Default Input Context Mappings
+	UPROPERTY(config)
+	TMap<TSoftObjectPtr<UInputMappingContext>, FInputMappingOverrideArray> SavedInputMappingOverrides;
+
 	UPROPERTY(config)
 	uint8 SavedInputVersion = 0;
 };
@@ -21,4 +21,31 @@ public:
 	UButton* SectionButton = nullptr;
 
 };
+
+/**
+ * Forwards a section button's click to its UINavWidget along with that section's index
+ */
+UCLASS()
+class UINAVIGATION_API UUINavSectionButtonBinding : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	void Bind(UButton* InButton, class UUINavWidget* InWidget, const int32 InSectionIndex);
+
+	UFUNCTION()
+	void OnSectionButtonClicked();
+
+protected:
+
+	UPROPERTY()
+	UButton* Button = nullptr;
+
+	UPROPERTY()
+	class UUINavWidget* Widget = nullptr;
+
+	int32 SectionIndex = INDEX_NONE;
+
+};
  
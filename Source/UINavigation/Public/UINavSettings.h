@@ -51,6 +51,11 @@ public:
 	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	bool bSetFocusOnRelease = true;
 
+	// Whether focus changes, rebind cancellation and navigation sounds caused by hovering UINavComponents should be applied at most once per frame, for the last hovered component.
+	// Every hover still updates the hovered state and button style right away.
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	bool bCoalesceHoverFocus = false;
+
 	// Whether to play the OnNavigated sound from the UINavComponent when navigating to the first UINavComponent of the widget
 	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	bool bPlayOnNavigatedSoundOnFirstUINavComponent = false;
@@ -83,10 +88,35 @@ public:
 	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	bool bAllowFocusOnViewportInGameAndUI = false;
 
+	// The amount of time without new rebinds after which the rebound inputs are saved to disk (0 to save right away)
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	float InputSaveDelay = 1.0f;
+
 	// Whether to load the input icons asynchronously, in order to prevent Load Flushes
 	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	bool bLoadInputIconsAsync = false;
 
+	// Whether to load the assets referenced by the saved and default input mappings asynchronously, in a single batch, before applying them
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	bool bLoadInputContextsAsync = false;
+
+	// Whether each local player gets its own copy of the input contexts, so that rebinds, rebuilds and saves only affect that player.
+	// Input contexts added outside of UINavigation should be fetched with UUINavLocalPlayerSubsystem::GetPlayerInputContext.
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	bool bUsePerPlayerInputContexts = false;
+
+	// The save slot where the player's named input profiles are stored
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FString InputProfilesSaveSlot = TEXT("UINavInputProfiles");
+
+	// Estimated memory that parent widgets using the EvictUnderBudget retention policy can keep alive before the least recently removed ones are evicted
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (ClampMin = 0))
+	int32 RetainedParentsMemoryBudgetKB = 4096;
+
+	// How many prompt widgets of each class are kept around for reuse once dismissed. 0 creates a new prompt widget every time
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (ClampMin = 0))
+	int32 MaxPooledPromptWidgets = 2;
+
 	// The amount of mouse movement delta that will trigger a rebind attempt when listening to a new key for input rebinding
 	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	float MouseMoveRebindThreshold = 2.0f;
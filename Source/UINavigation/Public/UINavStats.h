@@ -0,0 +1,42 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+class UUINavWidget;
+class UUINavComponent;
+class UUINavInputBox;
+
+DECLARE_STATS_GROUP(TEXT("UINavigation"), STATGROUP_UINavigation, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PC Tick"), STAT_UINavPCTick, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Handle Analog Input"), STAT_UINavHandleAnalogInput, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Refresh Navigation Keys"), STAT_UINavRefreshNavigationKeys, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Handle Focus Changing"), STAT_UINavHandleFocusChanging, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Navigated To"), STAT_UINavNavigatedTo, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Initial Setup"), STAT_UINavInitialSetup, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Create Input Boxes"), STAT_UINavCreateInputBoxes, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rebind Key"), STAT_UINavRebindKey, STATGROUP_UINavigation, UINAVIGATION_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Live UINav Widgets"), STAT_UINavLiveWidgets, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Live UINav Components"), STAT_UINavLiveComponents, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Live Input Boxes"), STAT_UINavLiveInputBoxes, STATGROUP_UINavigation, UINAVIGATION_API);
+
+UE_TRACE_CHANNEL_EXTERN(UINavChannel, UINAVIGATION_API);
+
+// Scopes a CPU profiler event on the UINav trace channel, so it can be toggled with -trace=UINav
+#define UINAV_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, UINavChannel)
+
+/**
+*	Emits timestamped navigation, focus and rebind events on the UINav trace channel
+*/
+namespace UINavTrace
+{
+	UINAVIGATION_API void TraceNavigation(const UUINavWidget* Widget, const UUINavComponent* FromComponent, const UUINavComponent* ToComponent);
+	UINAVIGATION_API void TraceFocus(const UUINavWidget* Widget, const bool bFocused);
+	UINAVIGATION_API void TraceRebind(const UUINavInputBox* InputBox, const FKey& NewKey, const int32 KeyIndex);
+}
@@ -8,11 +8,14 @@
 #include "Data/SelectorPosition.h"
 #include "Data/NavigationEvent.h"
 #include "Data/ThumbstickAsMouse.h"
+#include "Data/ParentRetentionPolicy.h"
+#include "Data/NavigationSnapshot.h"
 #include "UObject/Object.h"
 #include "Data/PromptData.h"
 #include "Templates/SharedPointer.h"
 #include "Widgets/SWidget.h"
 #include "Slate/SObjectWidget.h"
+#include "Engine/StreamableManager.h"
 #include "UINavWidget.generated.h"
 
 class UUINavComponent;
@@ -23,6 +26,8 @@ class UScrollBox;
 class UInputMappingContext;
 class UWidgetSwitcher;
 class UButton;
+class UUINavSectionButtonBinding;
+class UListView;
 enum class EButtonStyle : uint8;
 enum class EUINavigation : uint8;
 enum class EUINavigationAction : uint8;
@@ -67,6 +72,14 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "UINavWidget")
 	UUINavComponent* CurrentComponent = nullptr;
 
+	// When the current component is a ListView entry, the item it was displaying, since entry widgets get recycled for other items
+	TWeakObjectPtr<UListView> CurrentListView;
+	TWeakObjectPtr<UObject> CurrentListItem;
+	int32 CurrentListItemIndex = INDEX_NONE;
+
+	// The first ListView with UINavComponent entries, focused initially if there's no FirstComponent
+	TWeakObjectPtr<UListView> FirstListView;
+
 	UPROPERTY()
 	UUINavComponent* HoveredComponent = nullptr;
 
@@ -85,13 +98,35 @@ protected:
 	UPROPERTY()
 	UUINavComponent* IgnoreHoverComponent;
 
+	// The last hovered component waiting to receive focus on the next tick, when bCoalesceHoverFocus is enabled
+	UPROPERTY()
+	UUINavComponent* PendingHoverFocusComponent = nullptr;
+
+	/**
+	*	Cancels any rebind, restores forced navigation and focuses the given hovered component.
+	*	Runs once per frame for the last hovered component when bCoalesceHoverFocus is enabled.
+	*/
+	void ApplyHoveredComponent(UUINavComponent* Component);
+
 	TArray<int> UINavWidgetPath;
 
 	TArray<UButton*> SectionButtons;
+	// The navigable widget in each of the UINavSwitcher's children, null for sections without one or whose lazy content wasn't created yet
 	TArray<UWidget*> SectionWidgets;
 
+	UPROPERTY()
+	TArray<UUINavSectionButtonBinding*> SectionButtonBindings;
+
+	// Indices of the sections whose lazy content was already created
+	TSet<int32> CreatedLazySections;
+
+	TMap<int32, TSharedPtr<FStreamableHandle>> LazySectionLoadHandles;
+
 	bool bUsingSplitScreen = false;
 
+	// Navigation state taken when this widget opened a child widget, held by the most outer UINavWidget
+	FNavigationSnapshot NavigationSnapshot;
+
 	/******************************************************************************/
 
 	UUINavWidget(const FObjectInitializer& ObjectInitializer);
@@ -106,6 +141,22 @@ protected:
 	*/
 	void CleanSetup();
 
+	/**
+	*	Stores the navigation state of the given widget, nested in this one, before it opens a child widget
+	*/
+	void SaveNavigationSnapshot(UUINavWidget* NavigatedWidget);
+
+	/**
+	*	Restores the navigation state stored by SaveNavigationSnapshot, if the widget tree didn't change since
+	*
+	*	@return Whether the snapshot was restored, in which case there's no need to reconfigure the widget
+	*/
+	bool TryRestoreNavigationSnapshot();
+
+	void RestoreNavigationState(const FNavigationSnapshot& Snapshot);
+
+	uint32 GetWidgetTreeHash() const;
+
 	/**
 	*	Configures the UINavPC
 	*/
@@ -140,26 +191,19 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = UINavWidget)
 	void GoToSection(const int32 SectionIndex);
 
-	UFUNCTION()
-	void OnSectionButtonPressed1();
-	UFUNCTION()
-	void OnSectionButtonPressed2();
-	UFUNCTION()
-	void OnSectionButtonPressed3();
-	UFUNCTION()
-	void OnSectionButtonPressed4();
-	UFUNCTION()
-	void OnSectionButtonPressed5();
-	UFUNCTION()
-	void OnSectionButtonPressed6();
-	UFUNCTION()
-	void OnSectionButtonPressed7();
-	UFUNCTION()
-	void OnSectionButtonPressed8();
-	UFUNCTION()
-	void OnSectionButtonPressed9();
-	UFUNCTION()
-	void OnSectionButtonPressed10();
+	/**
+	*	Creates the lazy content of the given section right away if it wasn't created yet, loading its class synchronously if needed
+	*/
+	void LoadSectionContent(const int32 SectionIndex);
+
+	/**
+	*	Loads the class of the given section's lazy content in the background and creates the content once it's loaded
+	*/
+	void PrefetchSectionContent(const int32 SectionIndex);
+
+	void PrefetchAdjacentSections(const int32 SectionIndex);
+
+	void CreateLazySectionContent(const int32 SectionIndex, UClass* const ContentClass);
 
 public:
 
@@ -235,6 +279,18 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
 	bool bWrapAutoSectionNavigation = true;
 
+	/*
+	* Widgets to create inside the UINavSwitcher's child at the given section index the first time that section is visited,
+	* instead of constructing every section along with this widget.
+	* The UINavSwitcher's child at each of these indices should be an empty PanelWidget.
+	*/
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
+	TMap<int32, TSoftClassPtr<UUserWidget>> LazySectionContent;
+
+	//If set to true, the lazy content of the sections next to the active one will be loaded and created in the background
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
+	bool bPrefetchAdjacentSections = true;
+
 	/*
 	* Input Context to be used to replace the default one. for each platform, in this specific widget (assuming a child widget doesn't override that)
 	* The Map's Key (String) should be the name of the platform you want to override. Leave blank if this applies to all platforms.
@@ -263,6 +319,31 @@ public:
 	bool bCompletedSetup = false;
 	bool bSetupStarted = false;
 
+	/*
+	* How this widget is kept while a child widget that removed it from the viewport is open.
+	* EvictUnderBudget only applies to widgets that aren't nested in another UINavWidget.
+	*/
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
+	EParentRetentionPolicy ParentRetentionPolicy = EParentRetentionPolicy::RemoveFromViewport;
+
+	// Whether this widget was collapsed by a child widget instead of being removed from the viewport
+	bool bHiddenByChild = false;
+	ESlateVisibility VisibilityBeforeHidden = ESlateVisibility::SelfHitTestInvisible;
+
+	// The parent widget's state, if it was evicted while this widget was open
+	UPROPERTY()
+	FEvictedUINavWidget EvictedParent;
+
+	/**
+	*	Releases the parent widget, which must have been removed from the viewport, keeping what's needed to recreate it on return
+	*/
+	bool EvictParent();
+
+	/**
+	*	Recreates the parent widget if it was evicted
+	*/
+	void RestoreEvictedParent();
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "UINavigation Selector")
 	UCurveFloat* MoveCurve = nullptr;
 
@@ -279,6 +360,9 @@ public:
 	/*********************************************************************************/
 
 	
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+
 	virtual void NativeConstruct() override;
 
 	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
@@ -346,6 +430,13 @@ public:
 
 	void SetFocusOnComponent(UUINavComponent* Component);
 
+	void UpdateCurrentListItem(UUINavComponent* Component);
+
+	/**
+	*	Navigates back to the list item the current component was displaying, even if its entry widget was recycled or released since then
+	*/
+	bool TryFocusOnCurrentListItem();
+
 	void PropagateGainNavigation(UUINavWidget* PreviousActiveWidget, UUINavWidget* NewActiveWidget, const UUINavWidget* const CommonParent);
 
 	virtual void GainNavigation(UUINavWidget* PreviousActiveWidget);
@@ -639,6 +730,8 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavWidget)
 	UUINavWidget* GetMostOuterUINavWidget();
 
+	void OnSectionButtonPressed(const int32 SectionIndex);
+
 	UUINavWidget* GetChildUINavWidget(const int ChildIndex) const;
 
 	FORCEINLINE TArray<int> GetUINavWidgetPath() const { return UINavWidgetPath; }
@@ -651,6 +744,15 @@ public:
 
 	void SetFirstComponent(UUINavComponent* Component);
 
+	void SetFirstListView(UListView* ListView);
+
+	/**
+	*	Navigates to the item at the given index of a ListView or TileView whose entries are UINavComponents,
+	*	scrolling it into view first if its entry widget isn't generated
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	bool NavigateToListItem(UListView* ListView, const int32 ItemIndex);
+
 	void RemovedComponent(UUINavComponent* Component);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavWidget)
@@ -4,11 +4,32 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleInterface.h"
 
-class FUINavigationModule : public IModuleInterface
+class FUINavInputProcessor;
+class UUINavPCComponent;
+
+UINAVIGATION_API DECLARE_LOG_CATEGORY_EXTERN(LogUINavigation, Log, All);
+
+class UINAVIGATION_API FUINavigationModule : public IModuleInterface
 {
 public:
 
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	static FUINavigationModule& Get();
+
+	/**
+	*	Routes the input of the given Slate user to the given UINavPC, registering the shared input preprocessor if needed
+	*/
+	void RegisterUINavPC(UUINavPCComponent* UINavPC, const int32 UserIndex);
+
+	/**
+	*	Stops routing input to the given UINavPC, unregistering the shared input preprocessor if no UINavPCs are left
+	*/
+	void UnregisterUINavPC(UUINavPCComponent* UINavPC);
+
+private:
+
+	TSharedPtr<FUINavInputProcessor> InputProcessor;
 };
\ No newline at end of file
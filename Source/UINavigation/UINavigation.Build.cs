@@ -34,7 +34,8 @@ public UINavigation(ReadOnlyTargetRules Target) : base(Target)
                 "EnhancedInput",
                 "RHI",
                 "HeadMountedDisplay",
-				"AssetRegistry"
+				"AssetRegistry",
+				"TraceLog"
 			}
 			);
 		
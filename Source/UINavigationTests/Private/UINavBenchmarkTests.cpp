@@ -0,0 +1,261 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+#include "UINavBenchmark.h"
+#include "UINavBlueprintFunctionLibrary.h"
+#include "UINavPCComponent.h"
+#include "UINavTestWidgets.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+static TAutoConsoleVariable<int32> CVarUINavTestIterations(
+	TEXT("UINav.Tests.Iterations"),
+	100,
+	TEXT("Number of iterations of each measurement made by the UINavigation.Benchmark automation tests"));
+
+/**
+*	Measures and verifies a synthetic widget tree in the PIE world, then writes the results to Saved/UINavigation/BenchmarkTests
+*/
+class FUINavTreeBenchmarkCommand : public IAutomationLatentCommand
+{
+public:
+
+	FUINavTreeBenchmarkCommand(FAutomationTestBase* InTest, const FString& InName, const FUINavTestTreeDesc& InDesc, const int32 InIterations)
+		: Test(InTest)
+		, Name(InName)
+		, Desc(InDesc)
+		, Iterations(InIterations)
+	{
+	}
+
+	virtual bool Update() override
+	{
+		if (GetCurrentRunTime() > Timeout)
+		{
+			Test->AddError(FString::Printf(TEXT("%s timed out"), *Name));
+			CloseWidgets();
+			return true;
+		}
+
+		switch (Phase)
+		{
+			case EPhase::FindPC:
+			{
+				UWorld* const World = GEditor != nullptr ? GEditor->PlayWorld.Get() : nullptr;
+				UINavPC = World != nullptr ? UUINavBlueprintFunctionLibrary::GetFirstUINavPC(World) : nullptr;
+				if (!UINavPC.IsValid())
+				{
+					return false;
+				}
+
+				RootWidget = OpenTestWidget(UINavPC.Get(), FUINavTestTreeDesc());
+				Phase = EPhase::WaitForRoot;
+				return false;
+			}
+			case EPhase::WaitForRoot:
+			{
+				if (!IsSetupComplete(RootWidget))
+				{
+					return false;
+				}
+
+				const FUINavTestTreeDesc TreeDesc = Desc;
+				OpenWidgetMeasurement = MakeUnique<UINavBenchmark::FOpenWidgetMeasurement>(
+					UINavPC.Get(),
+					[TreeDesc](UUINavPCComponent* PC) { return OpenTestWidget(PC, TreeDesc); },
+					TEXT("OpenWidget"),
+					Iterations);
+				Phase = EPhase::MeasureOpen;
+				return false;
+			}
+			case EPhase::MeasureOpen:
+			{
+				if (!OpenWidgetMeasurement->Update())
+				{
+					return false;
+				}
+
+				Results.Add(OpenWidgetMeasurement->GetResult());
+				OpenWidgetMeasurement.Reset();
+
+				if (!UINavPC.IsValid())
+				{
+					Test->AddError(FString::Printf(TEXT("%s: The UINavPCComponent was destroyed"), *Name));
+					return true;
+				}
+
+				TestWidget = OpenTestWidget(UINavPC.Get(), Desc);
+				Phase = EPhase::WaitForTestWidget;
+				return false;
+			}
+			case EPhase::WaitForTestWidget:
+			{
+				if (!IsSetupComplete(TestWidget))
+				{
+					return false;
+				}
+
+				Verify();
+				UINavBenchmark::MeasureActiveWidget(UINavPC.Get(), Iterations, Results);
+				CloseWidgets();
+
+				const FString OutputPath = UINavBenchmark::WriteResults(Results, FString::Printf(TEXT("BenchmarkTests/%s.json"), *Name));
+				Test->AddInfo(FString::Printf(TEXT("%s results written to %s"), *Name, *OutputPath));
+				return true;
+			}
+		}
+
+		return true;
+	}
+
+private:
+
+	enum class EPhase : uint8
+	{
+		FindPC,
+		WaitForRoot,
+		MeasureOpen,
+		WaitForTestWidget,
+	};
+
+	static constexpr double Timeout = 120.0;
+
+	FAutomationTestBase* Test;
+	FString Name;
+	FUINavTestTreeDesc Desc;
+	int32 Iterations;
+
+	EPhase Phase = EPhase::FindPC;
+	TWeakObjectPtr<UUINavPCComponent> UINavPC;
+	TWeakObjectPtr<UUINavTestWidget> RootWidget;
+	TWeakObjectPtr<UUINavTestWidget> TestWidget;
+	TUniquePtr<UINavBenchmark::FOpenWidgetMeasurement> OpenWidgetMeasurement;
+	TArray<UINavBenchmark::FResult> Results;
+
+	static UUINavTestWidget* OpenTestWidget(UUINavPCComponent* PC, const FUINavTestTreeDesc& TreeDesc)
+	{
+		UUINavTestWidget* const Widget = CreateWidget<UUINavTestWidget>(PC->GetPC(), UUINavTestWidget::StaticClass());
+		Widget->BuildTree(TreeDesc);
+		PC->GoToBuiltWidget(Widget, /*bRemoveParent*/ false);
+		return Widget;
+	}
+
+	static bool IsSetupComplete(const TWeakObjectPtr<UUINavTestWidget>& Widget)
+	{
+		return Widget.IsValid() && Widget->bCompletedSetup;
+	}
+
+	void Verify()
+	{
+		UUINavTestWidget* const Widget = TestWidget.Get();
+		Test->TestTrue(TEXT("The test widget is active"), UINavPC->GetActiveWidget() == Widget);
+		Test->TestEqual(TEXT("Number of components"), Widget->TestComponents.Num(), Desc.NumComponents);
+
+		int32 NestedDepth = 0;
+		for (const UUINavWidget* ChildWidget = Widget; ChildWidget->ChildUINavWidgets.Num() > 0; ChildWidget = ChildWidget->ChildUINavWidgets[0])
+		{
+			Test->TestTrue(TEXT("Nested widget completed its setup"), ChildWidget->ChildUINavWidgets[0]->bCompletedSetup);
+			++NestedDepth;
+		}
+		Test->TestEqual(TEXT("Nested widget depth"), NestedDepth, Desc.NumNestedWidgets);
+
+		const int32 NumInputBoxes = IsValid(Widget->TestInputContainer) ? Widget->TestInputContainer->InputBoxes.Num() : 0;
+		Test->TestEqual(TEXT("Number of input boxes"), NumInputBoxes, Desc.NumInputActions);
+	}
+
+	void CloseWidgets()
+	{
+		if (TestWidget.IsValid())
+		{
+			TestWidget->ReturnToParent();
+		}
+
+		if (RootWidget.IsValid())
+		{
+			RootWidget->ReturnToParent();
+		}
+	}
+};
+
+static void QueueTreeBenchmark(FAutomationTestBase* Test, const FString& Name, const FUINavTestTreeDesc& Desc)
+{
+	UWorld* const World = FAutomationEditorCommonUtils::CreateNewMap();
+	World->GetWorldSettings()->DefaultGameMode = AUINavTestGameMode::StaticClass();
+
+	const int32 Iterations = FMath::Max(1, CVarUINavTestIterations.GetValueOnGameThread());
+
+	ADD_LATENT_AUTOMATION_COMMAND(FStartPIECommand(false));
+	ADD_LATENT_AUTOMATION_COMMAND(FUINavTreeBenchmarkCommand(Test, Name, Desc, Iterations));
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand());
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FUINavNestedWidgetsBenchmarkTest, "UINavigation.Benchmark.NestedWidgets",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+void FUINavNestedWidgetsBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 Depth : { 1, 4, 8 })
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Levels"), Depth));
+		OutTestCommands.Add(FString::FromInt(Depth));
+	}
+}
+
+bool FUINavNestedWidgetsBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FUINavTestTreeDesc Desc;
+	Desc.NumNestedWidgets = FCString::Atoi(*Parameters);
+	QueueTreeBenchmark(this, FString::Printf(TEXT("NestedWidgets_%d"), Desc.NumNestedWidgets), Desc);
+	return true;
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FUINavGridBenchmarkTest, "UINavigation.Benchmark.Grid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+void FUINavGridBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 NumComponents : { 16, 64, 256 })
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Components"), NumComponents));
+		OutTestCommands.Add(FString::FromInt(NumComponents));
+	}
+}
+
+bool FUINavGridBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FUINavTestTreeDesc Desc;
+	Desc.NumComponents = FCString::Atoi(*Parameters);
+	Desc.NumColumns = 8;
+	QueueTreeBenchmark(this, FString::Printf(TEXT("Grid_%d"), Desc.NumComponents), Desc);
+	return true;
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FUINavInputContainerBenchmarkTest, "UINavigation.Benchmark.InputContainer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+void FUINavInputContainerBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 NumActions : { 8, 32, 128 })
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Actions"), NumActions));
+		OutTestCommands.Add(FString::FromInt(NumActions));
+	}
+}
+
+bool FUINavInputContainerBenchmarkTest::RunTest(const FString& Parameters)
+{
+	FUINavTestTreeDesc Desc;
+	Desc.NumInputActions = FCString::Atoi(*Parameters);
+	QueueTreeBenchmark(this, FString::Printf(TEXT("InputContainer_%d"), Desc.NumInputActions), Desc);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
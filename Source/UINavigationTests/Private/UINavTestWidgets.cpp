@@ -0,0 +1,159 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "UINavTestWidgets.h"
+#include "UINavController.h"
+#include "UINavButtonBase.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/HorizontalBox.h"
+#include "Components/Image.h"
+#include "Components/Overlay.h"
+#include "Components/TextBlock.h"
+#include "Components/UniformGridPanel.h"
+#include "Components/VerticalBox.h"
+#include "InputAction.h"
+#include "InputCoreTypes.h"
+#include "InputMappingContext.h"
+
+AUINavTestGameMode::AUINavTestGameMode()
+{
+	PlayerControllerClass = AUINavController::StaticClass();
+}
+
+void UUINavTestComponent::NativeOnInitialized()
+{
+	if (WidgetTree->RootWidget == nullptr)
+	{
+		NavButton = WidgetTree->ConstructWidget<UUINavButtonBase>(UUINavButtonBase::StaticClass(), TEXT("NavButton"));
+		NavText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("NavText"));
+		NavButton->AddChild(NavText);
+		WidgetTree->RootWidget = NavButton;
+	}
+
+	Super::NativeOnInitialized();
+}
+
+void UUINavTestInputComponent::NativeOnInitialized()
+{
+	if (WidgetTree->RootWidget == nullptr)
+	{
+		NavButton = WidgetTree->ConstructWidget<UUINavButtonBase>(UUINavButtonBase::StaticClass(), TEXT("NavButton"));
+		UOverlay* const Overlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Overlay"));
+		InputImage = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("InputImage"));
+		NavText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("NavText"));
+		Overlay->AddChildToOverlay(InputImage);
+		Overlay->AddChildToOverlay(NavText);
+		NavButton->AddChild(Overlay);
+		WidgetTree->RootWidget = NavButton;
+	}
+
+	Super::NativeOnInitialized();
+}
+
+void UUINavTestInputBox::NativeOnInitialized()
+{
+	if (WidgetTree->RootWidget == nullptr)
+	{
+		UHorizontalBox* const Root = WidgetTree->ConstructWidget<UHorizontalBox>(UHorizontalBox::StaticClass(), TEXT("Root"));
+		InputText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("InputText"));
+		InputButton1 = WidgetTree->ConstructWidget<UUINavTestInputComponent>(UUINavTestInputComponent::StaticClass(), TEXT("InputButton1"));
+		InputButton2 = WidgetTree->ConstructWidget<UUINavTestInputComponent>(UUINavTestInputComponent::StaticClass(), TEXT("InputButton2"));
+		InputButton3 = WidgetTree->ConstructWidget<UUINavTestInputComponent>(UUINavTestInputComponent::StaticClass(), TEXT("InputButton3"));
+		Root->AddChildToHorizontalBox(InputText);
+		Root->AddChildToHorizontalBox(InputButton1);
+		Root->AddChildToHorizontalBox(InputButton2);
+		Root->AddChildToHorizontalBox(InputButton3);
+		WidgetTree->RootWidget = Root;
+	}
+
+	Super::NativeOnInitialized();
+}
+
+void UUINavTestInputContainer::AddInputActions(const int32 NumActions)
+{
+	TArray<FKey> Keys;
+	EKeys::GetAllKeys(Keys);
+	Keys.RemoveAll([](const FKey& Key)
+	{
+		return !Key.IsBindableToActions() || Key.IsGamepadKey() || Key.IsMouseButton() || Key.IsTouch() ||
+			Key.IsAnalog() || Key.IsModifierKey() || Key == EKeys::Escape;
+	});
+
+	if (Keys.Num() == 0)
+	{
+		return;
+	}
+
+	UInputMappingContext* const InputContext = NewObject<UInputMappingContext>(this);
+	FInputContainerEnhancedActionDataArray& ActionDataArray = EnhancedInputs.Add(InputContext);
+	for (int32 i = 0; i < NumActions; ++i)
+	{
+		UInputAction* const Action = NewObject<UInputAction>(InputContext, *FString::Printf(TEXT("IA_Test%d"), i));
+
+		// Actions outnumbering the keys share them, which also exercises the collision checks
+		InputContext->MapKey(Action, Keys[i % Keys.Num()]);
+
+		FInputContainerEnhancedActionData& ActionData = ActionDataArray.Actions.AddDefaulted_GetRef();
+		ActionData.Action = Action;
+		ActionData.DisplayName = FText::FromName(Action->GetFName());
+	}
+}
+
+void UUINavTestInputContainer::NativeOnInitialized()
+{
+	InputBox_BP = UUINavTestInputBox::StaticClass();
+
+	if (WidgetTree->RootWidget == nullptr)
+	{
+		InputBoxesPanel = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), TEXT("InputBoxesPanel"));
+		WidgetTree->RootWidget = InputBoxesPanel;
+	}
+
+	Super::NativeOnInitialized();
+}
+
+void UUINavTestWidget::BuildTree(const FUINavTestTreeDesc& Desc)
+{
+	UVerticalBox* const Root = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), TEXT("Root"));
+	WidgetTree->RootWidget = Root;
+
+	if (Desc.NumColumns > 0)
+	{
+		UUniformGridPanel* const Grid = WidgetTree->ConstructWidget<UUniformGridPanel>(UUniformGridPanel::StaticClass(), TEXT("Grid"));
+		Root->AddChildToVerticalBox(Grid);
+		for (int32 i = 0; i < Desc.NumComponents; ++i)
+		{
+			UUINavTestComponent* const Component = WidgetTree->ConstructWidget<UUINavTestComponent>(UUINavTestComponent::StaticClass());
+			Grid->AddChildToUniformGrid(Component, i / Desc.NumColumns, i % Desc.NumColumns);
+			TestComponents.Add(Component);
+		}
+	}
+	else
+	{
+		UVerticalBox* const List = WidgetTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), TEXT("List"));
+		Root->AddChildToVerticalBox(List);
+		for (int32 i = 0; i < Desc.NumComponents; ++i)
+		{
+			UUINavTestComponent* const Component = WidgetTree->ConstructWidget<UUINavTestComponent>(UUINavTestComponent::StaticClass());
+			List->AddChildToVerticalBox(Component);
+			TestComponents.Add(Component);
+		}
+	}
+
+	if (Desc.NumInputActions > 0)
+	{
+		TestInputContainer = WidgetTree->ConstructWidget<UUINavTestInputContainer>(UUINavTestInputContainer::StaticClass(), TEXT("InputContainer"));
+		TestInputContainer->AddInputActions(Desc.NumInputActions);
+		Root->AddChildToVerticalBox(TestInputContainer);
+	}
+
+	if (Desc.NumNestedWidgets > 0)
+	{
+		FUINavTestTreeDesc NestedDesc = Desc;
+		--NestedDesc.NumNestedWidgets;
+		NestedDesc.NumInputActions = 0;
+
+		NestedWidget = WidgetTree->ConstructWidget<UUINavTestWidget>(UUINavTestWidget::StaticClass(), TEXT("NestedWidget"));
+		NestedWidget->BuildTree(NestedDesc);
+		Root->AddChildToVerticalBox(NestedWidget);
+	}
+}
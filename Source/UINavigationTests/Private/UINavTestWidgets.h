@@ -0,0 +1,113 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "GameFramework/GameModeBase.h"
+#include "UINavWidget.h"
+#include "UINavComponent.h"
+#include "UINavInputComponent.h"
+#include "UINavInputBox.h"
+#include "UINavInputContainer.h"
+#include "UINavTestWidgets.generated.h"
+
+class UInputMappingContext;
+
+/**
+*	The size of a synthetic widget tree, built in code so that the tests don't depend on widget blueprints
+*/
+struct FUINavTestTreeDesc
+{
+	// Number of UINavComponents in each widget of the tree
+	int32 NumComponents = 8;
+
+	// Components are laid out in a uniform grid with this many columns, or in a vertical box if 0
+	int32 NumColumns = 0;
+
+	// Number of UINavWidgets nested in the root widget, each inside the previous one
+	int32 NumNestedWidgets = 0;
+
+	// Number of actions in the root widget's input container, which is only created if above 0
+	int32 NumInputActions = 0;
+};
+
+/**
+*	Plays with the UINavController, which implements IUINavPCReceiver and owns a UINavPCComponent
+*/
+UCLASS(NotBlueprintable)
+class AUINavTestGameMode : public AGameModeBase
+{
+	GENERATED_BODY()
+
+public:
+
+	AUINavTestGameMode();
+};
+
+UCLASS(NotBlueprintable)
+class UUINavTestComponent : public UUINavComponent
+{
+	GENERATED_BODY()
+
+protected:
+
+	virtual void NativeOnInitialized() override;
+};
+
+UCLASS(NotBlueprintable)
+class UUINavTestInputComponent : public UUINavInputComponent
+{
+	GENERATED_BODY()
+
+protected:
+
+	virtual void NativeOnInitialized() override;
+};
+
+UCLASS(NotBlueprintable)
+class UUINavTestInputBox : public UUINavInputBox
+{
+	GENERATED_BODY()
+
+protected:
+
+	virtual void NativeOnInitialized() override;
+};
+
+UCLASS(NotBlueprintable)
+class UUINavTestInputContainer : public UUINavInputContainer
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	*	Creates an input context with the given number of actions, each mapped to a keyboard key
+	*/
+	void AddInputActions(const int32 NumActions);
+
+protected:
+
+	virtual void NativeOnInitialized() override;
+};
+
+UCLASS(NotBlueprintable)
+class UUINavTestWidget : public UUINavWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	*	Builds the widget's hierarchy, must be called before the widget is added to the viewport
+	*/
+	void BuildTree(const FUINavTestTreeDesc& Desc);
+
+	UPROPERTY()
+	TArray<UUINavComponent*> TestComponents;
+
+	UPROPERTY()
+	UUINavTestInputContainer* TestInputContainer = nullptr;
+
+	UPROPERTY()
+	UUINavTestWidget* NestedWidget = nullptr;
+};
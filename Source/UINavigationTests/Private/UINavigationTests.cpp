@@ -0,0 +1,5 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, UINavigationTests)